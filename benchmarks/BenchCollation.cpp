@@ -0,0 +1,101 @@
+/**
+ * @file BenchCollation.cpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Sorting a million strings: std::collate comparisons against Collator sort keys.
+ * @date 2026-10-18
+ *
+ * @example BenchCollation.cpp
+ * @{
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <locale>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Collator.hpp"
+
+// Product and contact names built from accented syllables, in random order.
+static std::vector<std::string> makeStrings(std::size_t count) {
+    const char* syllables[] = {
+        "ma", "Ro", "\xC3\xA9" "l", "sa", "Ch", "\xC3\xB1" "a", "zu", "\xC3\xA5" "s", "Ko",
+        "ri", "\xC3\xB6" "n", "Be", "la", "t\xC3\xA8", "Da", "\xC3\xA7" "o", "vi", "Ne"
+    };
+    const std::size_t syllableCount = sizeof(syllables) / sizeof(syllables[0]);
+    std::vector<std::string> strings;
+    unsigned long seed = 42;
+
+    strings.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string value;
+        for (std::size_t s = 0; s < 4; ++s) {
+            seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+            value += syllables[(seed >> 33) % syllableCount];
+        }
+        strings.push_back(value);
+    }
+    return strings;
+}
+
+template<typename F>
+static double seconds(F work) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    work();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// First available of a UTF-8 English locale, the environment locale and the classic "C" locale.
+static std::locale systemLocale() {
+    const char* names[] = {"en_US.UTF-8", "C.UTF-8", ""};
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        try {
+            return std::locale(names[i]);
+        } catch (const std::runtime_error&) {}
+    }
+    return std::locale::classic();
+}
+
+int main() {
+    const std::vector<std::string> strings = makeStrings(1000000);
+
+    std::locale locale = systemLocale();
+    const std::collate<char>& collate = std::use_facet<std::collate<char>>(locale);
+    std::vector<std::string> byCollate = strings;
+    double collateTime = seconds([&]() {
+        std::sort(byCollate.begin(), byCollate.end(), [&](const std::string& a, const std::string& b) {
+            return collate.compare(a.data(), a.data() + a.size(), b.data(), b.data() + b.size()) < 0;
+        });
+    });
+
+    const Collator& collator = Collator::forLanguage("sv");
+    std::vector<std::pair<std::string, std::size_t>> keys(strings.size());
+    double keyTime = seconds([&]() {
+        for (std::size_t i = 0; i < strings.size(); ++i) {
+            keys[i].first = collator.sortKey(strings[i]);
+            keys[i].second = i;
+        }
+    });
+    double keySortTime = seconds([&]() { std::sort(keys.begin(), keys.end()); });
+
+    std::vector<std::string> byCollator = strings;
+    double collatorSortTime = seconds([&]() { collator.sort(byCollator); });
+
+    std::size_t keyBytes = 0;
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        keyBytes += keys[i].first.size();
+
+    std::cout << "strings:               " << strings.size() << std::endl;
+    std::cout << "std::collate sort:     " << collateTime * 1e3 << " ms (locale \"" << locale.name() << "\")" << std::endl;
+    std::cout << "Collator::sortKey:     " << keyTime * 1e3 << " ms, " << keyBytes / keys.size() << " bytes per key" << std::endl;
+    std::cout << "sort keys (memcmp):    " << keySortTime * 1e3 << " ms" << std::endl;
+    std::cout << "Collator::sort:        " << collatorSortTime * 1e3 << " ms (keys + sort + move)" << std::endl;
+    return byCollator.size() == strings.size() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/** @} */
@@ -0,0 +1,136 @@
+/**
+ * @file BenchCompressedCatalog.cpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief 60 languages of 2k keys: Catalog against CompressedCatalog, size and first / repeated lookups by block size.
+ * @date 2026-10-18
+ *
+ * @example BenchCompressedCatalog.cpp
+ * @{
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "CompressedCatalog.hpp"
+
+template<typename F>
+static double seconds(F work) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    work();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Each language has its own syllables; messages mix words, placeholders and plural arguments like UI strings.
+static std::vector<std::shared_ptr<Catalog>> makeCatalogs(std::size_t keyCount, std::size_t catalogCount) {
+    static const char* consonants[] = {"b", "d", "f", "g", "k", "l", "m", "n", "p", "r", "s", "t", "v", "z", "ch", "qu"};
+    static const char* vowels[] = {"a", "e", "i", "o", "u", "é", "ou", "ei"};
+    std::vector<std::string> names(keyCount);
+    for (std::size_t key = 0; key < keyCount; ++key)
+        names[key] = "screen" + std::to_string(key / 50) + ".label" + std::to_string(key % 50);
+    std::shared_ptr<const CatalogKeys> keys(new CatalogKeys(names));
+
+    std::vector<std::shared_ptr<Catalog>> catalogs;
+    for (std::size_t c = 0; c < catalogCount; ++c) {
+        std::mt19937 random(static_cast<unsigned>(c + 1));
+        std::vector<std::string> words(400);
+        for (std::size_t w = 0; w < words.size(); ++w)
+            for (std::size_t syllable = 0; syllable < 1 + random() % 3; ++syllable)
+                words[w] += std::string(consonants[(random() + c) % 16]) + vowels[(random() + c / 8) % 8];
+
+        std::shared_ptr<Catalog> catalog(new Catalog("l" + std::to_string(c), keys));
+        for (std::size_t key = 0; key < keyCount; ++key) {
+            std::mt19937 message(static_cast<unsigned>(key * 131 + c));
+            std::string text;
+            // Zipf-like: short words of the language come back often.
+            for (std::size_t w = 0; w < 4 + message() % 8; ++w)
+                text += (w ? " " : "") + words[(message() % 20) * (message() % 20)];
+            if (key % 3 == 0)
+                text += " {user}";
+            if (key % 10 == 0)
+                text += " {count, plural, one {# " + words[key % 40] + "} other {# " + words[key % 40] + "s}}";
+            catalog->set(key, text);
+        }
+        catalogs.push_back(catalog);
+    }
+    return catalogs;
+}
+
+int main() {
+    const std::size_t keyCount = 2000;
+    const std::size_t catalogCount = 60;
+    std::vector<std::shared_ptr<Catalog>> catalogs = makeCatalogs(keyCount, catalogCount);
+
+    std::shared_ptr<const CompressionDictionary> dictionary;
+    double training = seconds([&]() {
+        std::vector<std::string> samples;
+        for (std::size_t c = 0; c < catalogs.size(); ++c)
+            for (std::size_t key = 0; key < keyCount; key += 7) // a sample of every language
+                samples.push_back(catalogs[c]->text(key));
+        dictionary = CompressionDictionary::train(samples);
+    });
+    const Catalog& plain = *catalogs[catalogCount / 2];
+    const std::size_t repeats = 1000000;
+    std::size_t bytes = 0;
+    double baseline = seconds([&]() {
+        for (std::size_t i = 0; i < repeats; ++i)
+            bytes += std::string(plain.text(i % 4)).size();
+    });
+
+    std::cout << "messages:          " << keyCount * catalogCount << std::endl;
+    std::cout << "training:          " << training * 1e3 << " ms (" << dictionary->bytes().size() / 1024 << " KiB dictionary)" << std::endl;
+    std::cout << "Catalog lookup:    " << baseline * 1e9 / repeats << " ns (copy of an uncompressed string)" << std::endl;
+
+    // Larger blocks compress better and cost more on the first lookup of each.
+    const std::size_t blockSizes[] = {512, CompressedCatalog::DEFAULT_BLOCK_BYTES, 4096};
+    for (std::size_t b = 0; b < 3; ++b) {
+        std::vector<std::shared_ptr<const CompressedCatalog>> compressed;
+        double compression = seconds([&]() {
+            for (std::size_t c = 0; c < catalogs.size(); ++c)
+                compressed.push_back(std::shared_ptr<const CompressedCatalog>(new CompressedCatalog(*catalogs[c], dictionary, blockSizes[b])));
+        });
+
+        std::size_t rawBytes = 0;
+        std::size_t compressedBytes = dictionary->bytes().size();
+        for (std::size_t c = 0; c < compressed.size(); ++c) {
+            rawBytes += compressed[c]->uncompressedBytes();
+            for (std::size_t key = 0; key < keyCount; ++key)
+                if (compressed[c]->text(key) != catalogs[c]->text(key))
+                    return EXIT_FAILURE;
+            compressed[c]->releaseCache();
+            std::stringstream blob;
+            compressed[c]->write(blob);
+            compressedBytes += blob.str().size();
+        }
+
+        // First lookup: one key per block, every block cold. Repeated: the same hot key.
+        const CompressedCatalog& locale = *compressed[catalogCount / 2];
+        std::uint64_t misses = locale.stats().misses;
+        double first = seconds([&]() {
+            for (std::size_t key = 0; key < keyCount; key += keyCount / locale.blockCount())
+                bytes += locale.text(key).size();
+        });
+        std::uint64_t firstLookups = locale.stats().misses - misses;
+        double repeated = seconds([&]() {
+            for (std::size_t i = 0; i < repeats; ++i)
+                bytes += locale.text(i % 4).size();
+        });
+
+        std::cout << std::endl << "blocks of " << blockSizes[b] << " bytes:" << std::endl;
+        std::cout << "  raw strings:     " << rawBytes / 1024 << " KiB" << std::endl;
+        std::cout << "  compressed:      " << compressedBytes / 1024 << " KiB serialized with the dictionary ("
+                  << static_cast<double>(rawBytes) / compressedBytes << "x)" << std::endl;
+        std::cout << "  compression:     " << compression * 1e3 << " ms (" << locale.blockCount() << " blocks per language)" << std::endl;
+        std::cout << "  first lookup:    " << first * 1e9 / firstLookups << " ns (block decompressed)" << std::endl;
+        std::cout << "  repeated lookup: " << repeated * 1e9 / repeats << " ns (cached block)" << std::endl;
+    }
+    return bytes > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/** @} */
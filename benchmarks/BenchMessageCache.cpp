@@ -0,0 +1,63 @@
+/**
+ * @file BenchMessageCache.cpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Re-rendering a dashboard of plural messages: MessageFormat against MessageCache.
+ * @date 2026-10-18
+ *
+ * @example BenchMessageCache.cpp
+ * @{
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "MessageCache.hpp"
+
+template<typename F>
+static double seconds(F work) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    work();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    const std::size_t keyCount = 50;
+    const std::size_t frames = 20000;
+    std::vector<std::string> names(keyCount);
+    for (std::size_t key = 0; key < keyCount; ++key)
+        names[key] = "widget" + std::to_string(key);
+    std::shared_ptr<const CatalogKeys> keys(new CatalogKeys(names));
+    Catalog catalog("en", keys);
+    for (std::size_t key = 0; key < keyCount; ++key)
+        catalog.set(key, "{user} has {count, plural, =0 {no new message} one {# new message} other {# new messages}} in widget " + std::to_string(key));
+
+    // Each frame renders every widget, the counts change rarely.
+    std::vector<FormatArguments> arguments(keyCount);
+    for (std::size_t key = 0; key < keyCount; ++key)
+        arguments[key].add("user", "Ada").add("count", static_cast<int>(key % 7));
+
+    MessageCache cache(4096);
+    std::size_t uncachedBytes = 0;
+    std::size_t cachedBytes = 0;
+    double uncached = seconds([&]() {
+        for (std::size_t frame = 0; frame < frames; ++frame)
+            for (std::size_t key = 0; key < keyCount; ++key)
+                uncachedBytes += MessageFormat::format(catalog.text(key), arguments[key], catalog.languageCode()).size();
+    });
+    double cached = seconds([&]() {
+        for (std::size_t frame = 0; frame < frames; ++frame)
+            for (std::size_t key = 0; key < keyCount; ++key)
+                cachedBytes += cache.format(catalog, key, arguments[key]).size();
+    });
+
+    std::cout << "messages:          " << frames * keyCount << std::endl;
+    std::cout << "MessageFormat:     " << uncached * 1e3 << " ms" << std::endl;
+    std::cout << "MessageCache:      " << cached * 1e3 << " ms (hit rate " << cache.stats().hitRate() << ")" << std::endl;
+    return uncachedBytes == cachedBytes ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/** @} */
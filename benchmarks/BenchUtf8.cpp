@@ -0,0 +1,84 @@
+/**
+ * @file BenchUtf8.cpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Throughput of the catalog load pipeline: UTF-8 validation and NFC normalization.
+ * @date 2026-10-18
+ *
+ * @example BenchUtf8.cpp
+ * @{
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Utf8.hpp"
+#include "Catalog.hpp"
+
+// Translations of 60 locales: ASCII, accented Latin, Cyrillic, CJK and a few decomposed (NFD) strings.
+static std::vector<std::string> makeStrings(std::size_t totalBytes) {
+    const char* samples[] = {
+        "Sign in to continue", "Connexion s\xC3\xA9" "curis\xC3\xA9" "e", "Stra\xC3\x9F" "e und Hausnummer",
+        "\xD0\x92\xD0\xBE\xD0\xB9\xD1\x82\xD0\xB8 \xD0\xB2 \xD0\xB0\xD0\xBA\xD0\xBA\xD0\xB0\xD1\x83\xD0\xBD\xD1\x82",
+        "\xE3\x83\xAD\xE3\x82\xB0\xE3\x82\xA4\xE3\x83\xB3\xE3\x81\x97\xE3\x81\xA6\xE3\x81\x8F\xE3\x81\xA0\xE3\x81\x95\xE3\x81\x84",
+        "Re\xCC\x81sume\xCC\x81 te\xCC\x81le\xCC\x81" "charge\xCC\x81"
+    };
+    std::vector<std::string> strings;
+    std::size_t bytes = 0;
+
+    for (std::size_t i = 0; bytes < totalBytes; ++i) {
+        std::string value = samples[i % 6];
+        value += " #" + std::to_string(i);
+        bytes += value.size();
+        strings.push_back(value);
+    }
+    return strings;
+}
+
+template<typename F>
+static double seconds(F work) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    work();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    const std::size_t totalBytes = 50 * 1024 * 1024;
+    std::vector<std::string> strings = makeStrings(totalBytes);
+    std::string blob;
+    for (std::size_t i = 0; i < strings.size(); ++i)
+        blob += strings[i];
+
+    bool valid = true;
+    double validateTime = seconds([&]() { valid = Utf8::validate(blob); });
+
+    std::size_t denormalized = 0;
+    double checkTime = seconds([&]() {
+        for (std::size_t i = 0; i < strings.size(); ++i)
+            denormalized += Utf8::isNfc(strings[i]) ? 0 : 1;
+    });
+
+    std::size_t nfcBytes = 0;
+    double nfcTime = seconds([&]() {
+        for (std::size_t i = 0; i < strings.size(); ++i)
+            if (!Utf8::isNfc(strings[i]))
+                nfcBytes += Utf8::toNfc(strings[i]).size();
+    });
+
+    std::shared_ptr<const CatalogKeys> keys(new CatalogKeys(std::vector<std::string>(strings.size(), "key")));
+    Catalog catalog("xx", keys);
+    double loadTime = seconds([&]() {
+        for (std::size_t i = 0; i < strings.size(); ++i)
+            catalog.set(i, strings[i]);
+    });
+
+    double gigabytes = blob.size() / 1e9;
+    std::cout << "catalog size:        " << blob.size() / (1024 * 1024) << " MB, " << strings.size() << " strings" << std::endl;
+    std::cout << "Utf8::validate:      " << gigabytes / validateTime << " GB/s (" << validateTime * 1e3 << " ms)" << std::endl;
+    std::cout << "Utf8::isNfc:         " << gigabytes / checkTime << " GB/s (" << checkTime * 1e3 << " ms)" << std::endl;
+    std::cout << "Utf8::toNfc:         " << denormalized << " strings not in NFC normalized in " << nfcTime * 1e3 << " ms" << std::endl;
+    std::cout << "Catalog::set (load): " << gigabytes / loadTime << " GB/s (" << loadTime * 1e3 << " ms)" << std::endl;
+    return valid && nfcBytes > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
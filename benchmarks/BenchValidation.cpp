@@ -0,0 +1,76 @@
+/**
+ * @file BenchValidation.cpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief Validating 100k keys in 60 catalogs: calling thread only against ThreadPool::parallelFor().
+ * @date 2026-10-18
+ *
+ * @example BenchValidation.cpp
+ * @{
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CatalogValidator.hpp"
+
+// Every third message has a placeholder, every tenth a plural; catalog 7 misses keys and breaks one message.
+static std::vector<std::shared_ptr<Catalog>> makeCatalogs(std::size_t keyCount, std::size_t catalogCount) {
+    std::vector<std::string> names(keyCount);
+    for (std::size_t key = 0; key < keyCount; ++key)
+        names[key] = "screen" + std::to_string(key / 50) + ".label" + std::to_string(key % 50);
+    std::shared_ptr<const CatalogKeys> keys(new CatalogKeys(names));
+
+    std::vector<std::shared_ptr<Catalog>> catalogs;
+    for (std::size_t c = 0; c < catalogCount; ++c) {
+        std::shared_ptr<Catalog> catalog(new Catalog("l" + std::to_string(c), keys));
+        for (std::size_t key = 0; key < keyCount; ++key) {
+            if (c == 7 && key % 1000 == 0)
+                continue;
+            std::string text = "Translated label number " + std::to_string(key);
+            if (key % 10 == 0)
+                text += " {count, plural, one {# file} other {# files}}";
+            else if (key % 3 == 0)
+                text += " for {userName}";
+            if (c == 7 && key == 1)
+                text += " {broken";
+            catalog->set(key, text);
+        }
+        catalogs.push_back(catalog);
+    }
+    return catalogs;
+}
+
+template<typename F>
+static double seconds(F work) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    work();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    const std::size_t keyCount = 100000;
+    const std::size_t catalogCount = 60;
+    std::vector<std::shared_ptr<Catalog>> catalogs = makeCatalogs(keyCount, catalogCount);
+
+    CatalogValidator validator(catalogs[0]);
+    for (std::size_t c = 1; c < catalogs.size(); ++c)
+        validator.add(catalogs[c]);
+
+    ThreadPool pool;
+    std::vector<ValidationIssue> serial;
+    std::vector<ValidationIssue> parallel;
+    double serialTime = seconds([&]() { serial = validator.validate(); });
+    double parallelTime = seconds([&]() { parallel = validator.validate(pool); });
+
+    std::cout << "messages:          " << keyCount * catalogCount << std::endl;
+    std::cout << "calling thread:    " << serialTime * 1e3 << " ms" << std::endl;
+    std::cout << "parallelFor:       " << parallelTime * 1e3 << " ms (" << pool.size() << " workers + caller)" << std::endl;
+    std::cout << "issues:            " << parallel.size() << std::endl;
+    return serial.size() == parallel.size() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/** @} */
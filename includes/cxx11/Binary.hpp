@@ -0,0 +1,114 @@
+/**
+ * @file Binary.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <istream>
+#include <ostream>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Encoding helpers shared by the binary formats of the library.
+ *
+ * Integers are written as unsigned LEB128 varints, strings as a varint
+ * length followed by their bytes. Content hashes are FNV-1a 64.
+ */
+class Binary {
+
+    public:
+        static const std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+        static const std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+    public:
+        /**
+         * @brief Write an unsigned LEB128 varint, 7 bits per byte, low bits first.
+         */
+        static void writeVarint(std::ostream& out, std::uint64_t value) {
+            while (value >= 0x80) {
+                out.put(static_cast<char>((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            out.put(static_cast<char>(value));
+        }
+
+        /**
+         * @brief Read an unsigned LEB128 varint.
+         *
+         * @return true if read, false on end of stream or more than 64 bits.
+         */
+        static bool readVarint(std::istream& in, std::uint64_t& value) {
+            value = 0;
+            for (unsigned shift = 0; shift < 64; shift += 7) {
+                int byte = in.get();
+                if (byte == std::char_traits<char>::eof())
+                    return false;
+                value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+                if (!(byte & 0x80))
+                    return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Write a string as its varint length followed by its bytes.
+         */
+        static void writeString(std::ostream& out, const std::string& text) {
+            writeVarint(out, text.size());
+            out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        }
+
+        /**
+         * @brief Read a string written by writeString().
+         *
+         * @return true if read, false if the stream ends first.
+         */
+        static bool readString(std::istream& in, std::string& text) {
+            std::uint64_t size = 0;
+
+            return readVarint(in, size) && readBytes(in, size, text);
+        }
+
+        /**
+         * @brief Read `size` bytes into `text`.
+         *
+         * The string grows with the data actually read: a corrupted size from
+         * an untrusted stream fails at its end instead of allocating it all upfront.
+         *
+         * @return true if read, false if the stream ends first.
+         */
+        static bool readBytes(std::istream& in, std::uint64_t size, std::string& text) {
+            text.clear();
+            char buffer[4096];
+            while (size > 0) {
+                std::size_t chunk = size < sizeof(buffer) ? static_cast<std::size_t>(size) : sizeof(buffer);
+                if (!in.read(buffer, static_cast<std::streamsize>(chunk)))
+                    return false;
+                text.append(buffer, chunk);
+                size -= chunk;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Mix one value into an FNV-1a 64 hash.
+         */
+        static std::uint64_t fnv1a(std::uint64_t hash, std::uint64_t value) {
+            return (hash ^ value) * FNV_PRIME;
+        }
+
+        /**
+         * @brief Mix the bytes of a buffer into an FNV-1a 64 hash.
+         */
+        static std::uint64_t fnv1a(std::uint64_t hash, const char* data, std::size_t size) {
+            for (std::size_t i = 0; i < size; ++i)
+                hash = fnv1a(hash, static_cast<unsigned char>(data[i]));
+            return hash;
+        }
+
+};
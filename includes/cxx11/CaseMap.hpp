@@ -0,0 +1,519 @@
+/**
+ * @file CaseMap.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <cstring>
+
+#include "Utf8.hpp"
+#include "UnicodeData.hpp"
+
+/**
+ * @brief Locale-aware case mapping and accent folding into caller buffers.
+ *
+ * Runs of ASCII are mapped 16 bytes at a time with SSE2. Other code points
+ * use a compact table of case ranges (Latin, Greek, Cyrillic, Armenian,
+ * fullwidth) plus the rules of the language:
+ * - "tr", "az": dotted and dotless i (I <-> ı, İ <-> i);
+ * - "el": no accents on uppercase Greek;
+ * - every language: ß -> SS, final sigma (Σ -> ς at the end of a word).
+ *
+ * fold() lowercases and removes accents for search indexing, except on the
+ * letters the language treats as distinct ("ñ" in Spanish, "å ä ö" in
+ * Swedish, ...).
+ *
+ * Output never allocates: the buffer overloads write at most `capacity`
+ * bytes and return the full length like snprintf, capacityFor() bytes are
+ * always enough. The std::string overloads reuse the capacity of `out`.
+ *
+ * Example usage:
+ * @code
+ * const CaseMap& tr = CaseMap::forLanguage("tr");
+ * char buffer[64];
+ * std::size_t size = tr.toUpper("istanbul", 8, buffer, sizeof(buffer)); // "İSTANBUL"
+ * @endcode
+ *
+ * @note Input must be valid UTF-8, fold() expects it in NFC like the catalogs store it.
+ */
+class CaseMap {
+
+    public:
+
+        /**
+         * @brief Get the shared case map of a language, built on first use.
+         *
+         * @param code Language code, a region suffix ("tr-TR", "el_GR") is ignored.
+         * @return const CaseMap& Case map, root rules if the language has no tailoring.
+         */
+        static const CaseMap& forLanguage(const std::string& code) {
+            static std::mutex mutex;
+            static std::map<std::string, std::unique_ptr<CaseMap>> caseMaps;
+            std::string language = code.substr(0, code.find_first_of("-_"));
+
+            std::lock_guard<std::mutex> lock(mutex);
+            std::unique_ptr<CaseMap>& caseMap = caseMaps[language];
+            if (!caseMap)
+                caseMap.reset(new CaseMap(language));
+            return *caseMap;
+        }
+
+        /**
+         * @brief Build the case map of a language.
+         *
+         * @param code Language code (e.g., "tr"), empty for the root rules.
+         */
+        explicit CaseMap(const std::string& code = std::string())
+            : _code(code), _turkic(code == "tr" || code == "az"), _greek(code == "el") {
+            if (code == "es")
+                _keptInFold.push_back(0x00F1);                                          // ñ
+            else if (code == "sv" || code == "fi")
+                _keptInFold.insert(_keptInFold.end(), {0x00E4, 0x00E5, 0x00F6});        // ä å ö
+            else if (code == "da" || code == "nb" || code == "nn" || code == "no")
+                _keptInFold.insert(_keptInFold.end(), {0x00E5, 0x00E6, 0x00F8});        // å æ ø
+            else if (_turkic)
+                _keptInFold.insert(_keptInFold.end(), {0x00E7, 0x00F6, 0x00FC, 0x011F, 0x0131, 0x015F}); // ç ö ü ğ ı ş
+            std::sort(_keptInFold.begin(), _keptInFold.end());
+        }
+
+        /**
+         * @brief Get the language of the case map.
+         *
+         * @return const std::string& Language code, empty for the root rules.
+         */
+        const std::string& languageCode() const {
+            return _code;
+        }
+
+        /**
+         * @brief Get a buffer size always large enough for the output.
+         *
+         * @param size Input size in bytes.
+         * @return std::size_t Output capacity in bytes.
+         */
+        static std::size_t capacityFor(std::size_t size) {
+            return size * 3;
+        }
+
+        /**
+         * @brief Lowercase a UTF-8 buffer.
+         *
+         * @param text Valid UTF-8 bytes.
+         * @param size Number of bytes.
+         * @param out Destination, only whole code points are written.
+         * @param capacity Size of `out`.
+         * @return std::size_t Length of the full output, larger than `capacity` if it was truncated.
+         */
+        std::size_t toLower(const char* text, std::size_t size, char* out, std::size_t capacity) const {
+            return map(LOWER, text, size, out, capacity);
+        }
+
+        /**
+         * @brief Uppercase a UTF-8 buffer.
+         *
+         * @see toLower() for the parameters.
+         */
+        std::size_t toUpper(const char* text, std::size_t size, char* out, std::size_t capacity) const {
+            return map(UPPER, text, size, out, capacity);
+        }
+
+        /**
+         * @brief Lowercase and remove the accents of a UTF-8 buffer, for search indexing.
+         *
+         * @see toLower() for the parameters.
+         */
+        std::size_t fold(const char* text, std::size_t size, char* out, std::size_t capacity) const {
+            return map(FOLD, text, size, out, capacity);
+        }
+
+        /**
+         * @brief Lowercase a string into `out`, reusing its capacity.
+         *
+         * @param text Valid UTF-8 string.
+         * @param out Destination, replaced.
+         */
+        void toLower(const std::string& text, std::string& out) const {
+            mapString(LOWER, text, out);
+        }
+
+        /**
+         * @brief Uppercase a string into `out`, reusing its capacity.
+         *
+         * @see toLower()
+         */
+        void toUpper(const std::string& text, std::string& out) const {
+            mapString(UPPER, text, out);
+        }
+
+        /**
+         * @brief Fold a string into `out`, reusing its capacity.
+         *
+         * @see fold()
+         */
+        void fold(const std::string& text, std::string& out) const {
+            mapString(FOLD, text, out);
+        }
+
+    private:
+        enum Mode { LOWER, UPPER, FOLD };
+
+        /**
+         * @brief Case pairs: code points first, first + step, ... up to last are uppercase, lowercase is code + delta.
+         */
+        struct CaseRange {
+            std::uint32_t first;
+            std::uint32_t last;
+            std::int32_t delta;
+            std::uint32_t step;
+        };
+
+        /**
+         * @brief Destination buffer: counts every byte, writes while whole code points fit.
+         *
+         * Once a write does not fit, size stays above capacity so nothing else is written.
+         */
+        struct Output {
+            char* data;
+            std::size_t capacity;
+            std::size_t size;
+
+            void write(const char* bytes, std::size_t count) {
+                if (size + count <= capacity)
+                    std::memcpy(data + size, bytes, count);
+                size += count;
+            }
+
+            void put(std::uint32_t code) {
+                char bytes[4];
+                write(bytes, Utf8::encode(code, bytes));
+            }
+        };
+
+    private:
+        std::string _code;
+        bool _turkic;
+        bool _greek;
+        std::vector<std::uint32_t> _keptInFold; // sorted lowercase letters fold() keeps accented
+
+    private:
+        static const CaseRange* caseRanges(std::size_t& count) {
+            static const CaseRange ranges[] = {
+                {0x00C0, 0x00D6, 0x20, 1}, {0x00D8, 0x00DE, 0x20, 1},
+                {0x0100, 0x012E, 1, 2}, {0x0132, 0x0136, 1, 2}, {0x0139, 0x0147, 1, 2}, {0x014A, 0x0176, 1, 2},
+                {0x0178, 0x0178, -0x79, 1}, {0x0179, 0x017D, 1, 2},
+                {0x01CD, 0x01DB, 1, 2}, {0x01DE, 0x01EE, 1, 2}, {0x01F8, 0x021E, 1, 2}, {0x0222, 0x0232, 1, 2},
+                {0x0386, 0x0386, 0x26, 1}, {0x0388, 0x038A, 0x25, 1}, {0x038C, 0x038C, 0x40, 1}, {0x038E, 0x038F, 0x3F, 1},
+                {0x0391, 0x03A1, 0x20, 1}, {0x03A3, 0x03AB, 0x20, 1}, {0x03D8, 0x03EE, 1, 2},
+                {0x0400, 0x040F, 0x50, 1}, {0x0410, 0x042F, 0x20, 1}, {0x0460, 0x0480, 1, 2}, {0x048A, 0x04BE, 1, 2},
+                {0x04C0, 0x04C0, 0x0F, 1}, {0x04C1, 0x04CD, 1, 2}, {0x04D0, 0x052E, 1, 2},
+                {0x0531, 0x0556, 0x30, 1},
+                {0x1E00, 0x1E94, 1, 2}, {0x1E9E, 0x1E9E, 0x00DF - 0x1E9E, 1}, {0x1EA0, 0x1EFE, 1, 2},
+                {0xFF21, 0xFF3A, 0x20, 1}
+            };
+
+            count = sizeof(ranges) / sizeof(ranges[0]);
+            return ranges;
+        }
+
+        /**
+         * @brief Code points the tables cannot map (Hebrew to Georgian, CJK, ...).
+         */
+        static bool isUncased(std::uint32_t code) {
+            return (code >= 0x0590 && code < 0x1E00) || (code > 0x1EFF && code < 0xFF21) || code > 0xFF5A;
+        }
+
+        static std::uint32_t lowerOf(std::uint32_t code) {
+            if (code < 0x80)
+                return code >= 'A' && code <= 'Z' ? code + 0x20 : code;
+            if (code < 0x100)
+                return code >= 0xC0 && code <= 0xDE && code != 0xD7 ? code + 0x20 : code;
+            if (isUncased(code))
+                return code;
+
+            std::size_t count = 0;
+            const CaseRange* ranges = caseRanges(count);
+            for (std::size_t i = 0; i < count; ++i)
+                if (code >= ranges[i].first && code <= ranges[i].last && (code - ranges[i].first) % ranges[i].step == 0)
+                    return static_cast<std::uint32_t>(static_cast<std::int32_t>(code) + ranges[i].delta);
+            return code;
+        }
+
+        static std::uint32_t upperOf(std::uint32_t code) {
+            if (code < 0x80)
+                return code >= 'a' && code <= 'z' ? code - 0x20 : code;
+            switch (code) {
+                case 0x00B5: return 0x039C; // µ
+                case 0x0131: return 'I';    // ı
+                case 0x017F: return 'S';    // ſ
+                case 0x03C2: return 0x03A3; // ς
+                case 0x00DF: return code;   // ß, expanded to "SS" by map()
+                case 0x00FF: return 0x0178; // ÿ
+                default: break;
+            }
+            if (code < 0x100)
+                return code >= 0xE0 && code <= 0xFE && code != 0xF7 ? code - 0x20 : code;
+            if (isUncased(code))
+                return code;
+
+            std::size_t count = 0;
+            const CaseRange* ranges = caseRanges(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                std::uint32_t upper = static_cast<std::uint32_t>(static_cast<std::int32_t>(code) - ranges[i].delta);
+                if (upper >= ranges[i].first && upper <= ranges[i].last && (upper - ranges[i].first) % ranges[i].step == 0)
+                    return upper;
+            }
+            return code;
+        }
+
+        static bool isMark(std::uint32_t code) {
+            return (code >= 0x0300 && code < 0x0370) || (code >= 0x0370 && UnicodeData::combiningClass(code) != 0);
+        }
+
+        static bool isCased(std::uint32_t code) {
+            return code == 0x00DF || lowerOf(code) != code || upperOf(code) != code;
+        }
+
+        /**
+         * @brief Previous code point before `index` that is not a combining mark, 0 if none.
+         */
+        static std::uint32_t previousBase(const char* text, std::size_t index) {
+            while (index > 0) {
+                std::size_t start = index - 1;
+                while (start > 0 && (static_cast<unsigned char>(text[start]) & 0xC0) == 0x80)
+                    --start;
+                std::size_t next = start;
+                std::uint32_t code = Utf8::decode(text, index, next);
+                if (!isMark(code))
+                    return code;
+                index = start;
+            }
+            return 0;
+        }
+
+        /**
+         * @brief Next code point from `index` that is not a combining mark, 0 if none.
+         */
+        static std::uint32_t nextBase(const char* text, std::size_t size, std::size_t index) {
+            while (index < size) {
+                std::uint32_t code = Utf8::decode(text, size, index);
+                if (!isMark(code))
+                    return code;
+            }
+            return 0;
+        }
+
+        /**
+         * @brief Greek capital without its accent, for uppercase in "el".
+         */
+        static std::uint32_t withoutTonos(std::uint32_t code) {
+            switch (code) {
+                case 0x0386: return 0x0391;
+                case 0x0388: return 0x0395;
+                case 0x0389: return 0x0397;
+                case 0x038A: return 0x0399;
+                case 0x038C: return 0x039F;
+                case 0x038E: return 0x03A5;
+                case 0x038F: return 0x03A9;
+                case 0x0390: return 0x03AA; // ΐ -> Ϊ
+                case 0x03B0: return 0x03AB; // ΰ -> Ϋ
+                default: return code;
+            }
+        }
+
+        /**
+         * @brief Letter without its accents: canonical decomposition base, or the letters with a stroke.
+         *
+         * @return std::uint32_t Base letter, 0 if `code` expands to `first` + `second`.
+         */
+        static std::uint32_t foldBase(std::uint32_t code, std::uint32_t& first, std::uint32_t& second) {
+            switch (code) {
+                case 0x00E6: first = 'a'; second = 'e'; return 0; // æ
+                case 0x0153: first = 'o'; second = 'e'; return 0; // œ
+                case 0x00F8: return 'o';                          // ø
+                case 0x0111: return 'd';                          // đ
+                case 0x0127: return 'h';                          // ħ
+                case 0x0131: return 'i';                          // ı
+                case 0x0142: return 'l';                          // ł
+                default: break;
+            }
+            std::uint32_t mark = 0;
+            while (code >= 0x00C0 && UnicodeData::decompose(code, first, mark))
+                code = first;
+            return code;
+        }
+
+        void mapString(Mode mode, const std::string& text, std::string& out) const {
+            // Most mappings keep the length: try in place first, map again only if the output grew.
+            out.resize(text.size());
+            std::size_t size = out.empty() ? 0 : map(mode, text.data(), text.size(), &out[0], out.size());
+            if (size > out.size()) {
+                out.resize(size);
+                map(mode, text.data(), text.size(), &out[0], out.size());
+            }
+            out.resize(size);
+        }
+
+        std::size_t map(Mode mode, const char* text, std::size_t size, char* out, std::size_t capacity) const {
+            Output output = {out, capacity, 0};
+            std::size_t i = 0;
+
+            while (i < size) {
+                i += mapAscii(mode, text + i, size - i, output);
+                if (i >= size)
+                    break;
+
+                std::size_t start = i;
+                std::uint32_t code = Utf8::decode(text, size, i);
+                if (mode == UPPER)
+                    mapUpper(code, text, start, output);
+                else
+                    mapLower(mode, code, text, size, start, i, output);
+            }
+            return output.size;
+        }
+
+        /**
+         * @brief Map the leading ASCII run, 16 bytes at a time when SSE2 is available.
+         *
+         * Blocks holding a byte the language maps out of ASCII (I and i in
+         * Turkish) are mapped byte by byte.
+         *
+         * @return std::size_t Number of bytes consumed.
+         */
+        std::size_t mapAscii(Mode mode, const char* text, std::size_t size, Output& output) const {
+            const char special = !_turkic ? '\0' : mode == UPPER ? 'i' : 'I';
+            std::size_t i = 0;
+
+            #if defined(__SSE2__) || defined(_M_X64)
+                const bool upper = mode == UPPER;
+                const __m128i low = _mm_set1_epi8(upper ? 'a' - 1 : 'A' - 1);
+                const __m128i high = _mm_set1_epi8(upper ? 'z' + 1 : 'Z' + 1);
+                const __m128i flip = _mm_set1_epi8(0x20);
+                const __m128i stop = _mm_set1_epi8(special);
+            #endif
+            while (i < size) {
+                #if defined(__SSE2__) || defined(_M_X64)
+                    if (i + 16 <= size) {
+                        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+                        if (_mm_movemask_epi8(block) == 0
+                            && (special == '\0' || _mm_movemask_epi8(_mm_cmpeq_epi8(block, stop)) == 0)) {
+                            __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(block, low), _mm_cmplt_epi8(block, high));
+                            __m128i mapped = _mm_xor_si128(block, _mm_and_si128(letters, flip));
+                            if (output.size + 16 <= output.capacity) {
+                                _mm_storeu_si128(reinterpret_cast<__m128i*>(output.data + output.size), mapped);
+                                output.size += 16;
+                            } else {
+                                char bytes[16];
+                                _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes), mapped);
+                                output.write(bytes, 16);
+                            }
+                            i += 16;
+                            continue;
+                        }
+                    }
+                #endif
+                for (std::size_t end = std::min(i + 16, size); i < end;) {
+                    char c = text[i];
+                    if (static_cast<unsigned char>(c) >= 0x80)
+                        return i;
+                    if (c == special && special != '\0') {
+                        i += mapDottedI(mode, text + i, size - i, output);
+                        continue;
+                    }
+                    if (mode == UPPER ? (c >= 'a' && c <= 'z') : (c >= 'A' && c <= 'Z'))
+                        c = static_cast<char>(c ^ 0x20);
+                    output.write(&c, 1);
+                    ++i;
+                }
+            }
+            return i;
+        }
+
+        /**
+         * @brief Turkish i: "i" -> "İ" in uppercase, "I" -> "ı" and "I" + dot above -> "i" otherwise.
+         *
+         * @return std::size_t Number of bytes consumed.
+         */
+        static std::size_t mapDottedI(Mode mode, const char* text, std::size_t size, Output& output) {
+            if (mode == UPPER) {
+                output.write("\xC4\xB0", 2);
+                return 1;
+            }
+            if (size >= 3 && static_cast<unsigned char>(text[1]) == 0xCC && static_cast<unsigned char>(text[2]) == 0x87) {
+                output.write("i", 1);
+                return 3;
+            }
+            output.write("\xC4\xB1", 2);
+            return 1;
+        }
+
+        void mapUpper(std::uint32_t code, const char* text, std::size_t start, Output& output) const {
+            if (code == 0x00DF) {
+                output.write("SS", 2);
+                return;
+            }
+            if (_greek) {
+                std::uint32_t previous = previousBase(text, start);
+                if ((code == 0x0301 || code == 0x0342) && previous >= 0x0370 && previous < 0x0400)
+                    return; // accent on a Greek letter
+                output.put(withoutTonos(upperOf(code)));
+                return;
+            }
+            output.put(upperOf(code));
+        }
+
+        void mapLower(Mode mode, std::uint32_t code, const char* text, std::size_t size,
+                      std::size_t start, std::size_t next, Output& output) const {
+            if (code == 0x0130) {
+                if (mode == FOLD || _turkic)
+                    output.write("i", 1);
+                else
+                    output.write("i\xCC\x87", 3);
+                return;
+            }
+            if (code == 0x03A3 || code == 0x03C2) {
+                bool isFinal = mode == LOWER && code == 0x03A3 && isCased(previousBase(text, start))
+                    && !isCased(nextBase(text, size, next));
+                output.put(isFinal || (mode == LOWER && code == 0x03C2) ? 0x03C2 : 0x03C3);
+                return;
+            }
+            if (mode == LOWER) {
+                output.put(lowerOf(code));
+                return;
+            }
+
+            // FOLD: lowercase, then drop the accents unless the language keeps the letter.
+            if (code == 0x00DF || code == 0x1E9E) {
+                output.write("ss", 2);
+                return;
+            }
+            if (isMark(code))
+                return;
+            std::uint32_t lower = lowerOf(code);
+            if (std::binary_search(_keptInFold.begin(), _keptInFold.end(), lower)) {
+                output.put(lower);
+                return;
+            }
+            std::uint32_t first = 0;
+            std::uint32_t second = 0;
+            std::uint32_t base = foldBase(lower, first, second);
+            if (base == 0) {
+                output.put(first);
+                output.put(second);
+                return;
+            }
+            output.put(base);
+        }
+
+};
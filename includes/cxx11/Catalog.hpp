@@ -0,0 +1,413 @@
+/**
+ * @file Catalog.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <initializer_list>
+
+#include "Utf8.hpp"
+#include "TextMetrics.hpp"
+
+/**
+ * @brief Ordered list of message keys shared by the catalogs of a locale interface.
+ *
+ * A key is addressed by its index, so every catalog built on the same
+ * CatalogKeys stores its strings in the same dense order.
+ *
+ * Example usage:
+ * @code
+ * std::shared_ptr<const CatalogKeys> keys(new CatalogKeys({"signUpTitle", "signInTitle"}));
+ * keys->index("signInTitle"); // 1
+ * @endcode
+ */
+class CatalogKeys {
+
+    public:
+
+        /**
+         * @brief Returned by index() for an unknown key.
+         */
+        static const std::size_t npos = static_cast<std::size_t>(-1);
+
+        /**
+         * @brief Build the key list, duplicated names keep their first index.
+         *
+         * @param names Key names in index order.
+         */
+        explicit CatalogKeys(const std::vector<std::string>& names) : _names(names) {
+            for (std::size_t i = 0; i < _names.size(); ++i)
+                _indexes.insert(std::make_pair(_names[i], i));
+        }
+
+        /**
+         * @brief Build the key list from a braced list of names.
+         *
+         * @param names Key names in index order.
+         */
+        CatalogKeys(std::initializer_list<std::string> names) : CatalogKeys(std::vector<std::string>(names)) {}
+
+        /**
+         * @brief Get the number of keys.
+         *
+         * @return std::size_t Key count.
+         */
+        std::size_t size() const {
+            return _names.size();
+        }
+
+        /**
+         * @brief Get the index of a key.
+         *
+         * @param name Key name.
+         * @return std::size_t Index of the key, npos if unknown.
+         */
+        std::size_t index(const std::string& name) const {
+            std::unordered_map<std::string, std::size_t>::const_iterator it = _indexes.find(name);
+
+            if (it == _indexes.end())
+                return npos;
+            return it->second;
+        }
+
+        /**
+         * @brief Get the name of a key.
+         *
+         * @param index Key index, must be lower than size().
+         * @return const std::string& Key name.
+         */
+        const std::string& name(std::size_t index) const {
+            return _names[index];
+        }
+
+    private:
+        std::vector<std::string> _names;
+        std::unordered_map<std::string, std::size_t> _indexes;
+
+};
+
+/**
+ * @brief Runtime table of translated strings for one locale.
+ *
+ * A catalog is either a root (every key it does not define is missing) or a
+ * layer over a parent catalog (e.g. "fr-CA" over "fr", a tenant overlay over a
+ * base). The per-key fallback is flattened when the layer is built: each slot
+ * points to the string of the layer defining it, so a lookup is a single
+ * indexed load whatever the depth of the chain.
+ *
+ * Strings are immutable and reference counted: a layer shares the parent's
+ * strings instead of copying them. They are validated as UTF-8 and normalized
+ * to NFC when set, so what is stored is always safe to output. Their layout
+ * metadata (width, grapheme clusters, see TextMetrics) is measured at the same
+ * time and shared the same way.
+ *
+ * Example usage:
+ * @code
+ * std::shared_ptr<Catalog> fr(new Catalog("fr", keys));
+ * fr->set("signUpTitle", "Inscription");
+ * fr->set("signInTitle", "Connexion");
+ *
+ * std::shared_ptr<Catalog> frCA(new Catalog("fr-CA", fr));
+ * frCA->set("signInTitle", "Ouvrir une session");
+ * frCA->text(0); // "Inscription", inherited from fr
+ * @endcode
+ *
+ * @note A catalog is not synchronized: modify it before sharing it between threads.
+ */
+class Catalog {
+
+    public:
+
+        /**
+         * @brief Build an empty root catalog.
+         *
+         * @param code Language code of the catalog (e.g., "fr").
+         * @param keys Key list, shared with the other catalogs of the interface.
+         */
+        Catalog(const std::string& code, std::shared_ptr<const CatalogKeys> keys)
+            : _code(code), _keys(keys), _entries(keys->size()), _metrics(keys->size()), _overrides(keys->size(), false) {}
+
+        /**
+         * @brief Build a layer inheriting every key of `parent`.
+         *
+         * @param code Language code of the layer (e.g., "fr-CA").
+         * @param parent Catalog providing the keys the layer does not override.
+         */
+        Catalog(const std::string& code, std::shared_ptr<const Catalog> parent)
+            : _code(code), _keys(parent->_keys), _parent(parent),
+              _entries(parent->_entries), _metrics(parent->_metrics), _overrides(parent->_entries.size(), false) {}
+
+        /**
+         * @brief Copy a catalog, the copy gets its own id().
+         *
+         * @param other Catalog to copy.
+         */
+        Catalog(const Catalog& other)
+            : _code(other._code), _keys(other._keys), _parent(other._parent), _entries(other._entries),
+              _metrics(other._metrics), _overrides(other._overrides), _version(other._version) {}
+
+        /**
+         * @brief Copy the content of a catalog, this catalog gets a new id().
+         *
+         * @param other Catalog to copy.
+         * @return Catalog& This catalog.
+         */
+        Catalog& operator=(const Catalog& other) {
+            _code = other._code;
+            _keys = other._keys;
+            _parent = other._parent;
+            _entries = other._entries;
+            _metrics = other._metrics;
+            _overrides = other._overrides;
+            _version = other._version;
+            _id = nextId();
+            return *this;
+        }
+
+        /**
+         * @brief Get the language code of the catalog.
+         *
+         * @return const std::string& Language code.
+         */
+        const std::string& languageCode() const {
+            return _code;
+        }
+
+        /**
+         * @brief Get the key list of the catalog.
+         *
+         * @return const CatalogKeys& Key list.
+         */
+        const CatalogKeys& keys() const {
+            return *_keys;
+        }
+
+        /**
+         * @brief Get the version of the catalog content.
+         *
+         * @return std::uint64_t Version set by the loader or by a CatalogDelta, 0 by default.
+         */
+        std::uint64_t version() const {
+            return _version;
+        }
+
+        /**
+         * @brief Get the identifier of this catalog object.
+         *
+         * Unique in the process and never reused, unlike the address of a
+         * catalog: caches key on it to tell a reloaded catalog from the old one.
+         *
+         * @return std::uint64_t Identifier, assigned on construction and on copy.
+         */
+        std::uint64_t id() const {
+            return _id;
+        }
+
+        /**
+         * @brief Set the version of the catalog content.
+         *
+         * @param version Version, compared with CatalogDelta::baseVersion() when a delta is applied.
+         */
+        void setVersion(std::uint64_t version) {
+            _version = version;
+        }
+
+        /**
+         * @brief Get the parent of a layer.
+         *
+         * @return std::shared_ptr<const Catalog> Parent catalog, nullptr for a root.
+         */
+        std::shared_ptr<const Catalog> parent() const {
+            return _parent;
+        }
+
+        /**
+         * @brief Get the number of keys.
+         *
+         * @return std::size_t Key count, defined or not.
+         */
+        std::size_t size() const {
+            return _entries.size();
+        }
+
+        /**
+         * @brief Look up a string by key index.
+         *
+         * @param key Key index, must be lower than size().
+         * @return const std::string* Translated string, nullptr if missing in the whole chain.
+         */
+        const std::string* find(std::size_t key) const {
+            return _entries[key].get();
+        }
+
+        /**
+         * @brief Look up a string by key name.
+         *
+         * @param name Key name.
+         * @return const std::string* Translated string, nullptr if unknown or missing.
+         */
+        const std::string* find(const std::string& name) const {
+            std::size_t key = _keys->index(name);
+
+            return key == CatalogKeys::npos ? nullptr : find(key);
+        }
+
+        /**
+         * @brief Look up a string by key index.
+         *
+         * @param key Key index, must be lower than size().
+         * @return const std::string& Translated string, empty if missing.
+         */
+        const std::string& text(std::size_t key) const {
+            static const std::string missing;
+            const std::string* value = find(key);
+
+            return value ? *value : missing;
+        }
+
+        /**
+         * @brief Get the shared storage of a string.
+         *
+         * @param key Key index, must be lower than size().
+         * @return const std::shared_ptr<const std::string>& String owner, empty if missing.
+         */
+        const std::shared_ptr<const std::string>& entry(std::size_t key) const {
+            return _entries[key];
+        }
+
+        /**
+         * @brief Get the layout metadata of a string, measured when it was set.
+         *
+         * @param key Key index, must be lower than size().
+         * @return const TextMetrics* Width, code points and grapheme clusters, nullptr if missing.
+         */
+        const TextMetrics* metrics(std::size_t key) const {
+            return _metrics[key].get();
+        }
+
+        /**
+         * @brief Check whether this layer defines a key itself.
+         *
+         * @param key Key index, must be lower than size().
+         * @return true if the key is set in this catalog, false if inherited or missing.
+         */
+        bool overrides(std::size_t key) const {
+            return _overrides[key];
+        }
+
+        /**
+         * @brief Define or override a key in this layer.
+         *
+         * @param key Key index.
+         * @param value Translated string, stored in NFC.
+         * @return true on success, false if the key index is out of range or value is not valid UTF-8.
+         */
+        bool set(std::size_t key, const std::string& value) {
+            if (key >= _entries.size() || !Utf8::validate(value))
+                return false;
+            if (Utf8::isNfc(value))
+                return store(key, std::make_shared<const std::string>(value));
+            return store(key, std::make_shared<const std::string>(Utf8::toNfc(value)));
+        }
+
+        /**
+         * @brief Define or override a key in this layer, sharing an existing string.
+         *
+         * The string is shared as is when already in NFC, copied otherwise.
+         *
+         * @param key Key index.
+         * @param value Translated string owner.
+         * @return true on success, false if the key index is out of range, value is null or not valid UTF-8.
+         */
+        bool set(std::size_t key, std::shared_ptr<const std::string> value) {
+            if (key >= _entries.size() || !value || !Utf8::validate(*value))
+                return false;
+            if (!Utf8::isNfc(*value))
+                value = std::make_shared<const std::string>(Utf8::toNfc(*value));
+            return store(key, std::move(value));
+        }
+
+        /**
+         * @brief Define or override a key in this layer.
+         *
+         * @param name Key name.
+         * @param value Translated string.
+         * @return true on success, false if the key is unknown.
+         */
+        bool set(const std::string& name, const std::string& value) {
+            return set(_keys->index(name), value);
+        }
+
+        /**
+         * @brief Remove the override of a key, falling back to the parent again.
+         *
+         * @param key Key index.
+         * @return true if the key was overridden in this layer.
+         */
+        bool erase(std::size_t key) {
+            if (key >= _entries.size() || !_overrides[key])
+                return false;
+            _overrides[key] = false;
+            _entries[key] = _parent ? _parent->_entries[key] : std::shared_ptr<const std::string>();
+            _metrics[key] = _parent ? _parent->_metrics[key] : std::shared_ptr<const TextMetrics>();
+            return true;
+        }
+
+        /**
+         * @brief Move the layer over a new parent (e.g. a reloaded base catalog).
+         *
+         * Only the inherited slots are flattened again, overrides are kept.
+         *
+         * @param parent New parent, must use the same key list.
+         * @return true on success, false if the key lists differ.
+         */
+        bool rebase(std::shared_ptr<const Catalog> parent) {
+            if (!parent || parent->_keys != _keys)
+                return false;
+            for (std::size_t key = 0; key < _entries.size(); ++key)
+                if (!_overrides[key]) {
+                    _entries[key] = parent->_entries[key];
+                    _metrics[key] = parent->_metrics[key];
+                }
+            _parent = std::move(parent);
+            return true;
+        }
+
+    private:
+        std::string _code;
+        std::shared_ptr<const CatalogKeys> _keys;
+        std::shared_ptr<const Catalog> _parent;
+        std::vector<std::shared_ptr<const std::string>> _entries; // flattened: one slot per key
+        std::vector<std::shared_ptr<const TextMetrics>> _metrics; // metadata of _entries, same slots
+        std::vector<bool> _overrides;
+        std::uint64_t _version = 0;
+        std::uint64_t _id = nextId();
+
+    private:
+        static std::uint64_t nextId() {
+            static std::atomic<std::uint64_t> counter(0);
+
+            return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+
+        /**
+         * @brief Store a validated string as an override of this layer and measure it.
+         */
+        bool store(std::size_t key, std::shared_ptr<const std::string> value) {
+            _metrics[key] = std::shared_ptr<const TextMetrics>(new TextMetrics(TextMetrics::measure(*value)));
+            _entries[key] = std::move(value);
+            _overrides[key] = true;
+            return true;
+        }
+
+};
@@ -0,0 +1,218 @@
+/**
+ * @file CatalogDelta.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <istream>
+#include <ostream>
+#include <cstddef>
+#include <cstdint>
+
+#include "Catalog.hpp"
+#include "Binary.hpp"
+
+/**
+ * @brief Set of key changes turning one version of a catalog into the next.
+ *
+ * A delta names the language code and the version it applies to, and lists
+ * the keys to add or modify (set) and to remove. apply() builds a new catalog
+ * sharing every unchanged string with the base one, the base is not modified:
+ * readers holding it keep a consistent snapshot.
+ *
+ * Binary format (write() / read()): "I18D", version byte, then the language
+ * code, the base version, the new version, the change count and each change
+ * as an operation byte (0 set, 1 remove), the key name and, for set, the
+ * value. Strings are length-prefixed and every integer is an unsigned LEB128
+ * varint, as in CatalogExporter.
+ *
+ * Example usage:
+ * @code
+ * CatalogDelta delta("fr", 41, 42);
+ * delta.set("signInTitle", "Se connecter");
+ * delta.remove("loginSubTitle");
+ *
+ * i18n.applyDelta<LocaleCatalog>(delta); // "fr" now at version 42
+ * @endcode
+ *
+ * @see I18nContext::applyDelta
+ */
+class CatalogDelta {
+
+    public:
+
+        /**
+         * @brief Version byte written after the magic of the binary format.
+         */
+        static const unsigned char BINARY_VERSION = 1;
+
+        /**
+         * @brief One key change.
+         */
+        struct Change {
+            std::string key;    ///< Key name.
+            bool remove;        ///< true to remove the key, false to set it to `value`.
+            std::string value;  ///< New string, empty for a removal.
+        };
+
+        /**
+         * @brief Build an empty delta.
+         *
+         * @param code Language code of the catalog the delta applies to.
+         * @param baseVersion Version the catalog must have.
+         * @param version Version of the catalog once the delta is applied.
+         */
+        CatalogDelta(const std::string& code, std::uint64_t baseVersion, std::uint64_t version)
+            : _code(code), _baseVersion(baseVersion), _version(version) {}
+
+        /**
+         * @brief Get the language code of the catalog the delta applies to.
+         *
+         * @return const std::string& Language code.
+         */
+        const std::string& languageCode() const {
+            return _code;
+        }
+
+        /**
+         * @brief Get the version the delta applies to.
+         *
+         * @return std::uint64_t Required Catalog::version().
+         */
+        std::uint64_t baseVersion() const {
+            return _baseVersion;
+        }
+
+        /**
+         * @brief Get the version reached once the delta is applied.
+         *
+         * @return std::uint64_t New Catalog::version().
+         */
+        std::uint64_t version() const {
+            return _version;
+        }
+
+        /**
+         * @brief Get the changes, in application order.
+         *
+         * @return const std::vector<Change>& Changes.
+         */
+        const std::vector<Change>& changes() const {
+            return _changes;
+        }
+
+        /**
+         * @brief Add or modify a key.
+         *
+         * @param key Key name.
+         * @param value New string, validated and normalized when applied.
+         */
+        void set(const std::string& key, const std::string& value) {
+            Change change = {key, false, value};
+            _changes.push_back(change);
+        }
+
+        /**
+         * @brief Remove a key, a layer falls back to its parent again.
+         *
+         * @param key Key name.
+         */
+        void remove(const std::string& key) {
+            Change change = {key, true, std::string()};
+            _changes.push_back(change);
+        }
+
+        /**
+         * @brief Build the next version of a catalog.
+         *
+         * The new catalog copies the table of string pointers of `base` (one
+         * pointer per key), then only the changed keys are validated, stored
+         * and measured. Unchanged strings and their metadata are shared.
+         *
+         * @param base Catalog at baseVersion(), with the same language code.
+         * @return std::shared_ptr<Catalog> New catalog at version(), nullptr if the
+         * code or version does not match, a key is unknown or a value is not valid UTF-8.
+         */
+        std::shared_ptr<Catalog> apply(const Catalog& base) const {
+            if (base.languageCode() != _code || base.version() != _baseVersion)
+                return nullptr;
+
+            std::shared_ptr<Catalog> snapshot = std::make_shared<Catalog>(base);
+            for (std::size_t i = 0; i < _changes.size(); ++i) {
+                std::size_t key = base.keys().index(_changes[i].key);
+                if (key == CatalogKeys::npos)
+                    return nullptr;
+                if (_changes[i].remove)
+                    snapshot->erase(key);
+                else if (!snapshot->set(key, _changes[i].value))
+                    return nullptr;
+            }
+            snapshot->setVersion(_version);
+            return snapshot;
+        }
+
+        /**
+         * @brief Serialize the delta in the binary format.
+         *
+         * @param out Destination stream, opened in binary mode.
+         */
+        void write(std::ostream& out) const {
+            out.write("I18D", 4);
+            out.put(static_cast<char>(BINARY_VERSION));
+            Binary::writeString(out, _code);
+            Binary::writeVarint(out, _baseVersion);
+            Binary::writeVarint(out, _version);
+            Binary::writeVarint(out, _changes.size());
+            for (std::size_t i = 0; i < _changes.size(); ++i) {
+                out.put(_changes[i].remove ? 1 : 0);
+                Binary::writeString(out, _changes[i].key);
+                if (!_changes[i].remove)
+                    Binary::writeString(out, _changes[i].value);
+            }
+        }
+
+        /**
+         * @brief Parse a delta written by write().
+         *
+         * @param in Source stream, opened in binary mode.
+         * @return std::shared_ptr<CatalogDelta> Parsed delta, nullptr if the data is truncated or malformed.
+         */
+        static std::shared_ptr<CatalogDelta> read(std::istream& in) {
+            char magic[5] = {0};
+            std::string code;
+            std::uint64_t baseVersion = 0;
+            std::uint64_t version = 0;
+            std::uint64_t count = 0;
+
+            if (!in.read(magic, 5) || std::string(magic, 4) != "I18D" || magic[4] != static_cast<char>(BINARY_VERSION))
+                return nullptr;
+            if (!Binary::readString(in, code) || !Binary::readVarint(in, baseVersion) || !Binary::readVarint(in, version) || !Binary::readVarint(in, count))
+                return nullptr;
+
+            std::shared_ptr<CatalogDelta> delta = std::make_shared<CatalogDelta>(code, baseVersion, version);
+            for (std::uint64_t i = 0; i < count; ++i) {
+                Change change = {std::string(), false, std::string()};
+                int operation = in.get();
+                if (operation != 0 && operation != 1)
+                    return nullptr;
+                change.remove = operation == 1;
+                if (!Binary::readString(in, change.key) || (!change.remove && !Binary::readString(in, change.value)))
+                    return nullptr;
+                delta->_changes.push_back(change);
+            }
+            return delta;
+        }
+
+    private:
+        std::string _code;
+        std::uint64_t _baseVersion;
+        std::uint64_t _version;
+        std::vector<Change> _changes;
+
+};
@@ -0,0 +1,133 @@
+/**
+ * @file CatalogLocale.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+
+#include "ILocale.hpp"
+#include "TypeTraits.hpp"
+#include "Catalog.hpp"
+#include "EncodedCatalog.hpp"
+#include "CatalogExporter.hpp"
+
+/**
+ * @brief Locale implementation reading its strings from a runtime Catalog.
+ *
+ * Implements `languageCode()` from the catalog, the concrete locale only maps
+ * each getter of the interface to a key index. The UTF-16 and UTF-32 forms of
+ * the strings are transcoded on first use and cached with the locale, so they
+ * are shared by every context using it.
+ *
+ * Example usage:
+ * @code
+ * enum DefaultKey { SignUpTitle, SignInTitle };
+ *
+ * class LocaleCatalog : public CatalogLocale<DefaultLocale> {
+ * public:
+ *     using CatalogLocale<DefaultLocale>::CatalogLocale;
+ *     const std::string getSignUpTitle() const override { return text(SignUpTitle); }
+ *     const std::string getSignInTitle() const override { return text(SignInTitle); }
+ * };
+ *
+ * context.setSupportedCatalog<LocaleCatalog>(catalog);
+ * @endcode
+ *
+ * @tparam T is the base locale interface derived from ILocale.
+ *
+ * @see I18nContext::setSupportedCatalog
+ */
+template<typename T, typename = typename std::enable_if<is_derived_from<T, ILocale>::value>::type>
+class CatalogLocale : public T {
+
+    public:
+
+        /**
+         * @brief Build the locale over a catalog.
+         *
+         * @param catalog Strings of the locale, shared and never modified.
+         */
+        explicit CatalogLocale(std::shared_ptr<const Catalog> catalog) : _catalog(catalog) {}
+
+        /**
+         * @brief Retrieve the language code of the catalog.
+         *
+         * @return std::string Language code.
+         */
+        const std::string languageCode() const override {
+            return _catalog->languageCode();
+        }
+
+        /**
+         * @brief Get the catalog backing the locale.
+         *
+         * @return const std::shared_ptr<const Catalog>& Catalog.
+         */
+        const std::shared_ptr<const Catalog>& catalog() const {
+            return _catalog;
+        }
+
+        /**
+         * @brief Get the strings of the catalog in UTF-16, transcoded on first call.
+         *
+         * Thread-safe, later calls return the same pool without transcoding.
+         *
+         * @return const Utf16Catalog& UTF-16 strings, by key index.
+         */
+        const Utf16Catalog& utf16() const {
+            std::call_once(_utf16Once, [this]() { _utf16.reset(new Utf16Catalog(*_catalog)); });
+            return *_utf16;
+        }
+
+        /**
+         * @brief Get the strings of the catalog in UTF-32, transcoded on first call.
+         *
+         * Thread-safe, later calls return the same pool without transcoding.
+         *
+         * @return const Utf32Catalog& UTF-32 strings, by key index.
+         */
+        const Utf32Catalog& utf32() const {
+            std::call_once(_utf32Once, [this]() { _utf32.reset(new Utf32Catalog(*_catalog)); });
+            return *_utf32;
+        }
+
+        /**
+         * @brief Get the content hash of the whole catalog, computed on first call.
+         *
+         * @return std::uint64_t Same value as `CatalogExporter(catalog()).hash()`.
+         */
+        std::uint64_t contentHash() const {
+            std::call_once(_hashOnce, [this]() { _hash = CatalogExporter(_catalog).hash(); });
+            return _hash;
+        }
+
+    protected:
+        /**
+         * @brief Look up a string of the catalog.
+         *
+         * @param key Key index.
+         * @return const std::string& Translated string, empty if missing.
+         */
+        const std::string& text(std::size_t key) const {
+            return _catalog->text(key);
+        }
+
+    private:
+        std::shared_ptr<const Catalog> _catalog;
+        mutable std::once_flag _utf16Once;
+        mutable std::once_flag _utf32Once;
+        mutable std::unique_ptr<const Utf16Catalog> _utf16;
+        mutable std::unique_ptr<const Utf32Catalog> _utf32;
+        mutable std::once_flag _hashOnce;
+        mutable std::uint64_t _hash = 0;
+
+};
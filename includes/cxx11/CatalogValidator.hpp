@@ -0,0 +1,434 @@
+/**
+ * @file CatalogValidator.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+#include <algorithm>
+
+#include "Catalog.hpp"
+#include "ThreadPool.hpp"
+
+/**
+ * @brief Kind of problem found by CatalogValidator.
+ */
+enum class ValidationError {
+    MissingKey,             ///< Defined in the reference catalog, missing in the locale.
+    ExtraKey,               ///< Defined in the locale, not in the reference catalog.
+    PlaceholderMismatch,    ///< The locale uses other placeholders than the reference.
+    InvalidSyntax,          ///< Unbalanced braces, bad argument or plural arm.
+    MissingReference        ///< No catalog is registered for the reference language, nothing was checked.
+};
+
+/**
+ * @brief One problem found by CatalogValidator.
+ */
+struct ValidationIssue {
+    ValidationError error;      ///< Kind of problem.
+    std::string languageCode;   ///< Catalog with the problem.
+    std::string key;            ///< Key name.
+    std::string detail;         ///< Human-readable description.
+};
+
+/**
+ * @brief Cross-locale consistency check of runtime catalogs.
+ *
+ * With compiled locales the pure-virtual interface guarantees that every
+ * locale implements every key; catalogs are checked by this pass instead.
+ * Every catalog is compared with a reference one:
+ * - keys defined by the reference and missing in the catalog, and the reverse;
+ * - placeholders: `{name}` arguments, and `{name, plural|select|selectordinal, ...}`
+ *   with their arms, must be the same set (order is free);
+ * - message syntax: balanced braces, argument names made of letters, digits and
+ *   `_`, an `other` arm in every plural and select, ICU apostrophe quoting.
+ *
+ * The work is split over catalogs and key ranges with ThreadPool::parallelFor().
+ * Catalogs built on another key list are matched with the reference by key name.
+ *
+ * Example usage:
+ * @code
+ * CatalogValidator validator(context.getCatalog("en"));
+ * validator.add(context.getCatalog("fr"));
+ * validator.add(context.getCatalog("de"));
+ *
+ * ThreadPool pool;
+ * for (const ValidationIssue& issue : validator.validate(pool))
+ *     std::cerr << issue.languageCode << ": " << issue.key << ": " << issue.detail << std::endl;
+ * @endcode
+ *
+ * @see I18nContext::validateCatalogs
+ */
+class CatalogValidator {
+
+    public:
+
+        /**
+         * @brief Keys per parallel chunk used when none is given.
+         */
+        static const std::size_t DEFAULT_GRAIN = 2048;
+
+        /**
+         * @brief Start a validation against a reference catalog.
+         *
+         * @param reference Catalog every other one is compared with, must not be null.
+         */
+        explicit CatalogValidator(std::shared_ptr<const Catalog> reference) : _reference(reference) {}
+
+        /**
+         * @brief Add a catalog to compare with the reference.
+         *
+         * @param catalog Catalog to check, ignored if null or the reference itself.
+         */
+        void add(std::shared_ptr<const Catalog> catalog) {
+            if (catalog && catalog != _reference)
+                _catalogs.push_back(catalog);
+        }
+
+        /**
+         * @brief Run the validation on a pool and the calling thread.
+         *
+         * @param pool Workers, must not be the pool running the caller.
+         * @param grain Keys per chunk.
+         * @return std::vector<ValidationIssue> Issues sorted by language code then key, empty if consistent.
+         */
+        std::vector<ValidationIssue> validate(ThreadPool& pool, std::size_t grain = DEFAULT_GRAIN) const {
+            return run(&pool, grain);
+        }
+
+        /**
+         * @brief Run the validation on the calling thread only.
+         *
+         * @return std::vector<ValidationIssue> Issues sorted by language code then key, empty if consistent.
+         */
+        std::vector<ValidationIssue> validate() const {
+            return run(nullptr, DEFAULT_GRAIN);
+        }
+
+        /**
+         * @brief Check the syntax of a message and list its placeholders.
+         *
+         * @param message Message text.
+         * @param signature Set to the sorted placeholders, comma-separated
+         * (e.g. "count:plural,name"), the same for messages expecting the same arguments.
+         * @param error Set to the description of the first syntax error.
+         * @return true if the message is well-formed.
+         */
+        static bool parse(const std::string& message, std::string& signature, std::string& error) {
+            std::vector<std::string> names;
+
+            return parse(message, names, signature, error);
+        }
+
+    private:
+        static const std::size_t MAX_DEPTH = 16;
+
+    private:
+        std::shared_ptr<const Catalog> _reference;
+        std::vector<std::shared_ptr<const Catalog>> _catalogs;
+
+    private:
+        /**
+         * @brief Run `body` on the pool, or on the calling thread without one.
+         */
+        template<typename F>
+        static void forEach(ThreadPool* pool, std::size_t count, std::size_t grain, F body) {
+            if (pool)
+                pool->parallelFor(count, grain, body);
+            else if (count > 0)
+                body(0, count);
+        }
+
+        std::vector<ValidationIssue> run(ThreadPool* pool, std::size_t grain) const {
+            const Catalog& reference = *_reference;
+            const std::size_t keyCount = reference.size();
+            std::vector<std::string> signatures(keyCount);
+            std::vector<char> referenceValid(keyCount, 1);
+            std::vector<std::vector<std::size_t>> maps(_catalogs.size()); // reference key -> catalog key, empty if the lists are shared
+            std::vector<ValidationIssue> issues;
+            std::mutex mutex;
+
+            // Reference placeholders, then the key mapping of the catalogs with another key list.
+            forEach(pool, keyCount, grain, [&](std::size_t begin, std::size_t end) {
+                std::vector<ValidationIssue> found;
+                std::vector<std::string> names;
+                std::string error;
+
+                for (std::size_t key = begin; key < end; ++key) {
+                    const std::string* value = reference.find(key);
+                    if (value && !parse(*value, names, signatures[key], error)) {
+                        referenceValid[key] = 0;
+                        report(found, ValidationError::InvalidSyntax, reference, key, error);
+                    }
+                }
+                merge(mutex, issues, found);
+            });
+            forEach(pool, _catalogs.size(), 1, [&](std::size_t begin, std::size_t end) {
+                std::vector<ValidationIssue> found;
+
+                for (std::size_t i = begin; i < end; ++i)
+                    mapKeys(*_catalogs[i], maps[i], found);
+                merge(mutex, issues, found);
+            });
+
+            // One index per (catalog, reference key).
+            forEach(pool, _catalogs.size() * keyCount, grain, [&](std::size_t begin, std::size_t end) {
+                std::vector<ValidationIssue> found;
+                std::vector<std::string> names;
+                std::string signature;
+                std::string error;
+
+                for (std::size_t index = begin; index < end; ++index) {
+                    const std::size_t c = index / keyCount;
+                    const std::size_t key = index % keyCount;
+                    const Catalog& catalog = *_catalogs[c];
+                    const std::size_t local = maps[c].empty() ? key : maps[c][key];
+                    const std::string* value = local == CatalogKeys::npos ? nullptr : catalog.find(local);
+                    const bool expected = reference.find(key) != nullptr;
+
+                    if (!value) {
+                        if (expected)
+                            report(found, ValidationError::MissingKey, catalog, reference.keys().name(key), "missing, defined in " + reference.languageCode());
+                        continue;
+                    }
+                    if (!expected)
+                        report(found, ValidationError::ExtraKey, catalog, reference.keys().name(key), "not defined in " + reference.languageCode());
+                    if (!parse(*value, names, signature, error))
+                        report(found, ValidationError::InvalidSyntax, catalog, reference.keys().name(key), error);
+                    else if (expected && referenceValid[key] && signature != signatures[key])
+                        report(found, ValidationError::PlaceholderMismatch, catalog, reference.keys().name(key),
+                            "placeholders {" + signature + "}, " + reference.languageCode() + " has {" + signatures[key] + "}");
+                }
+                merge(mutex, issues, found);
+            });
+
+            std::sort(issues.begin(), issues.end(), [](const ValidationIssue& a, const ValidationIssue& b) {
+                if (a.languageCode != b.languageCode)
+                    return a.languageCode < b.languageCode;
+                if (a.key != b.key)
+                    return a.key < b.key;
+                return a.error < b.error;
+            });
+            return issues;
+        }
+
+        /**
+         * @brief Match the key list of a catalog with the reference one, reporting its extra keys.
+         */
+        void mapKeys(const Catalog& catalog, std::vector<std::size_t>& map, std::vector<ValidationIssue>& found) const {
+            const CatalogKeys& keys = catalog.keys();
+            const CatalogKeys& referenceKeys = _reference->keys();
+
+            if (&keys == &referenceKeys)
+                return;
+            map.resize(referenceKeys.size());
+            for (std::size_t key = 0; key < referenceKeys.size(); ++key)
+                map[key] = keys.index(referenceKeys.name(key));
+            for (std::size_t key = 0; key < keys.size(); ++key)
+                if (catalog.find(key) && referenceKeys.index(keys.name(key)) == CatalogKeys::npos)
+                    report(found, ValidationError::ExtraKey, catalog, keys.name(key), "unknown key in " + _reference->languageCode());
+        }
+
+        static void report(std::vector<ValidationIssue>& found, ValidationError error, const Catalog& catalog, std::size_t key, const std::string& detail) {
+            report(found, error, catalog, catalog.keys().name(key), detail);
+        }
+
+        static void report(std::vector<ValidationIssue>& found, ValidationError error, const Catalog& catalog, const std::string& key, const std::string& detail) {
+            ValidationIssue issue = {error, catalog.languageCode(), key, detail};
+            found.push_back(issue);
+        }
+
+        static void merge(std::mutex& mutex, std::vector<ValidationIssue>& issues, std::vector<ValidationIssue>& found) {
+            if (found.empty())
+                return;
+            std::lock_guard<std::mutex> lock(mutex);
+            issues.insert(issues.end(), found.begin(), found.end());
+        }
+
+        /**
+         * @brief parse() reusing the caller's buffers, with a fast path for messages without braces or quotes.
+         */
+        static bool parse(const std::string& message, std::vector<std::string>& names, std::string& signature, std::string& error) {
+            std::size_t i = 0;
+
+            signature.clear();
+            if (nextSpecial(message, 0) == message.size())
+                return true;
+
+            names.clear();
+            if (!parseMessage(message, i, 0, false, names, error))
+                return false;
+            std::sort(names.begin(), names.end());
+            names.erase(std::unique(names.begin(), names.end()), names.end());
+            for (std::size_t n = 0; n < names.size(); ++n) {
+                if (n > 0)
+                    signature += ',';
+                signature += names[n];
+            }
+            return true;
+        }
+
+        /**
+         * @brief Parse message text up to the end, or up to the `}` closing a plural or select arm.
+         */
+        static bool parseMessage(const std::string& m, std::size_t& i, std::size_t depth, bool plural, std::vector<std::string>& names, std::string& error) {
+            while ((i = nextSpecial(m, i)) < m.size()) {
+                char c = m[i];
+                if (c == '\'') {
+                    // '' is a literal quote, a quote before a special character starts a quoted literal.
+                    if (i + 1 < m.size() && m[i + 1] == '\'') {
+                        i += 2;
+                        continue;
+                    }
+                    if (i + 1 < m.size() && (m[i + 1] == '{' || m[i + 1] == '}' || (plural && m[i + 1] == '#'))) {
+                        std::size_t close = m.find('\'', i + 1);
+                        if (close == std::string::npos)
+                            return fail(error, "unterminated quote", i);
+                        i = close + 1;
+                        continue;
+                    }
+                } else if (c == '{') {
+                    if (!parseArgument(m, i, depth, names, error))
+                        return false;
+                    continue;
+                } else if (c == '}') {
+                    if (depth == 0)
+                        return fail(error, "unmatched '}'", i);
+                    return true;
+                }
+                ++i;
+            }
+            if (depth > 0)
+                return fail(error, "missing '}'", i);
+            return true;
+        }
+
+        /**
+         * @brief Parse `{name}`, `{name, type[, style]}` or `{name, plural|select, arms}` starting at `{`.
+         */
+        static bool parseArgument(const std::string& m, std::size_t& i, std::size_t depth, std::vector<std::string>& names, std::string& error) {
+            std::size_t start = i++;
+            std::string name;
+            std::string type;
+
+            if (depth >= MAX_DEPTH)
+                return fail(error, "arguments nested too deep", start);
+            skipSpaces(m, i);
+            if (!readIdentifier(m, i, name))
+                return fail(error, "invalid argument name", i);
+            skipSpaces(m, i);
+            if (i < m.size() && m[i] == '}') {
+                names.push_back(name);
+                ++i;
+                return true;
+            }
+            if (i >= m.size() || m[i] != ',')
+                return fail(error, "expected ',' or '}' after '" + name + "'", i);
+            ++i;
+            skipSpaces(m, i);
+            if (!readIdentifier(m, i, type))
+                return fail(error, "missing type of '" + name + "'", i);
+            skipSpaces(m, i);
+
+            if (type != "plural" && type != "select" && type != "selectordinal") {
+                // Simple formatted argument, e.g. {amount, number, currency}.
+                while (i < m.size() && m[i] != '}') {
+                    if (m[i] == '{')
+                        return fail(error, "unexpected '{' in the style of '" + name + "'", i);
+                    ++i;
+                }
+                if (i >= m.size())
+                    return fail(error, "missing '}'", start);
+                names.push_back(name);
+                ++i;
+                return true;
+            }
+
+            bool other = false;
+            if (i >= m.size() || m[i] != ',')
+                return fail(error, "expected ',' after '" + type + "'", i);
+            ++i;
+            for (;;) {
+                std::string selector;
+                skipSpaces(m, i);
+                if (i >= m.size())
+                    return fail(error, "missing '}'", start);
+                if (m[i] == '}')
+                    break;
+                if (type != "select" && m.compare(i, 7, "offset:") == 0) {
+                    for (i += 7; i < m.size() && m[i] >= '0' && m[i] <= '9'; ++i) {}
+                    continue;
+                }
+                if (m[i] == '=') {
+                    std::size_t digits = ++i;
+                    for (; i < m.size() && m[i] >= '0' && m[i] <= '9'; ++i) {}
+                    if (i == digits)
+                        return fail(error, "invalid selector '='", digits - 1);
+                } else if (!readIdentifier(m, i, selector)) {
+                    return fail(error, "invalid selector in '" + name + "'", i);
+                }
+                other = other || selector == "other";
+                skipSpaces(m, i);
+                if (i >= m.size() || m[i] != '{')
+                    return fail(error, "expected '{' after a selector of '" + name + "'", i);
+                ++i;
+                if (!parseMessage(m, i, depth + 1, type != "select", names, error))
+                    return false;
+                ++i;
+            }
+            if (!other)
+                return fail(error, "missing 'other' arm in '" + name + "'", start);
+            names.push_back(name + ":" + type);
+            ++i;
+            return true;
+        }
+
+        /**
+         * @brief Offset of the next '{', '}' or quote from `i`, 16 bytes at a time when SSE2 is available.
+         */
+        static std::size_t nextSpecial(const std::string& m, std::size_t i) {
+            const char* data = m.data();
+
+            #if defined(__SSE2__) || defined(_M_X64)
+                const __m128i open = _mm_set1_epi8('{');
+                const __m128i close = _mm_set1_epi8('}');
+                const __m128i quote = _mm_set1_epi8('\'');
+                for (; i + 16 <= m.size(); i += 16) {
+                    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                    __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, open), _mm_cmpeq_epi8(block, close)), _mm_cmpeq_epi8(block, quote));
+                    if (_mm_movemask_epi8(special) != 0)
+                        break;
+                }
+            #endif
+            while (i < m.size() && data[i] != '{' && data[i] != '}' && data[i] != '\'')
+                ++i;
+            return i;
+        }
+
+        static void skipSpaces(const std::string& m, std::size_t& i) {
+            while (i < m.size() && (m[i] == ' ' || m[i] == '\t' || m[i] == '\n' || m[i] == '\r'))
+                ++i;
+        }
+
+        static bool readIdentifier(const std::string& m, std::size_t& i, std::string& out) {
+            std::size_t start = i;
+
+            while (i < m.size() && ((m[i] >= 'a' && m[i] <= 'z') || (m[i] >= 'A' && m[i] <= 'Z') || (m[i] >= '0' && m[i] <= '9') || m[i] == '_'))
+                ++i;
+            out.assign(m, start, i - start);
+            return i > start;
+        }
+
+        static bool fail(std::string& error, const std::string& what, std::size_t offset) {
+            error = what + " at byte " + std::to_string(offset);
+            return false;
+        }
+
+};
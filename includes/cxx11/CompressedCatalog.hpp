@@ -0,0 +1,1030 @@
+/**
+ * @file CompressedCatalog.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <istream>
+#include <ostream>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+
+#include "Catalog.hpp"
+#include "Binary.hpp"
+
+/**
+ * @brief Byte history and literal code shared by the compressed catalogs of every language, trained on their strings.
+ *
+ * UI strings are too short to compress on their own: what repeats is spread
+ * across keys and languages (placeholders, plural syntax, common words). The
+ * dictionary collects those fragments once; each block of a CompressedCatalog
+ * is then compressed as if the dictionary preceded it, so its matches can
+ * point into the dictionary. What is left as literals is Huffman coded with
+ * a table trained on the same samples, stored once with the dictionary.
+ *
+ * Block format: the size of the sequence section, the sequences,
+ * then the literal bit stream. A sequence is a token (literal count, match
+ * length), a 16-bit little-endian match offset, long lengths continued in
+ * 255-valued bytes; the literals of every sequence are in the bit stream, in
+ * order. A block ends after the literals of its last sequence.
+ *
+ * Example usage:
+ * @code
+ * std::vector<std::string> samples;              // strings of every language
+ * std::shared_ptr<const CompressionDictionary> dictionary = CompressionDictionary::train(samples);
+ * CompressedCatalog fr(*frCatalog, dictionary);
+ * @endcode
+ *
+ * @see CompressedCatalog
+ */
+class CompressionDictionary {
+
+    public:
+
+        /**
+         * @brief Dictionary size used when none is given.
+         */
+        static const std::size_t DEFAULT_CAPACITY = 16 * 1024;
+
+        /**
+         * @brief Largest dictionary size: offsets are 16-bit and must reach it from a block.
+         */
+        static const std::size_t MAX_CAPACITY = 32 * 1024;
+
+        /**
+         * @brief Version byte written after the magic of the binary format.
+         */
+        static const unsigned char BINARY_VERSION = 1;
+
+        /**
+         * @brief Build a dictionary from its bytes, literals coded after their frequency in them.
+         *
+         * @param bytes Content, truncated to its last MAX_CAPACITY bytes.
+         */
+        explicit CompressionDictionary(const std::string& bytes)
+            : _bytes(bytes.size() > MAX_CAPACITY ? bytes.substr(bytes.size() - MAX_CAPACITY) : bytes) {
+            std::vector<std::uint64_t> frequencies(256, 0);
+
+            for (std::size_t i = 0; i < _bytes.size(); ++i)
+                ++frequencies[static_cast<unsigned char>(_bytes[i])];
+            index();
+            buildCode(codeLengths(frequencies));
+        }
+
+        /**
+         * @brief Build a dictionary from its bytes and literal code lengths, see train() and read().
+         *
+         * @param bytes Content, truncated to its last MAX_CAPACITY bytes.
+         * @param lengths Huffman code length of each byte value, 256 values of 1 to 12 bits forming a complete code.
+         */
+        CompressionDictionary(const std::string& bytes, const std::vector<unsigned char>& lengths)
+            : _bytes(bytes.size() > MAX_CAPACITY ? bytes.substr(bytes.size() - MAX_CAPACITY) : bytes) {
+            index();
+            buildCode(lengths);
+        }
+
+        /**
+         * @brief Train a dictionary on sample strings.
+         *
+         * Fragments are scored by the number of samples they appear in: the
+         * samples are split in as many ranges as the dictionary has segments,
+         * the best scoring segment of each range is kept and its fragments stop
+         * counting for the next ones, so the dictionary does not repeat itself.
+         * The literal code follows the byte frequencies of the samples.
+         *
+         * @param samples Strings to compress later, of every language sharing the dictionary.
+         * @param capacity Dictionary size in bytes, at most MAX_CAPACITY.
+         * @return std::shared_ptr<const CompressionDictionary> Trained dictionary, the samples themselves if they fit.
+         */
+        static std::shared_ptr<const CompressionDictionary> train(const std::vector<std::string>& samples, std::size_t capacity = DEFAULT_CAPACITY) {
+            std::string data;
+            std::vector<std::uint64_t> frequencies(256, 0);
+            std::unordered_map<std::uint64_t, Fragment> fragments;
+
+            capacity = capacity < MAX_CAPACITY ? capacity : static_cast<std::size_t>(MAX_CAPACITY);
+            for (std::size_t s = 0; s < samples.size(); ++s) {
+                data += samples[s];
+                for (std::size_t i = 0; i < samples[s].size(); ++i)
+                    ++frequencies[static_cast<unsigned char>(samples[s][i])];
+                for (std::size_t i = 0; i + FRAGMENT <= samples[s].size(); ++i) {
+                    Fragment& fragment = fragments[fragmentAt(samples[s].data() + i)];
+                    if (fragment.lastSample != s + 1) {
+                        fragment.lastSample = s + 1;
+                        ++fragment.samples;
+                    }
+                }
+            }
+            if (data.size() <= capacity)
+                return std::make_shared<CompressionDictionary>(data, codeLengths(frequencies));
+
+            std::string dictionary;
+            std::size_t ranges = std::max<std::size_t>(1, capacity / SEGMENT);
+            std::size_t rangeSize = data.size() / ranges;
+            for (std::size_t range = 0; range < ranges && dictionary.size() + SEGMENT <= capacity; ++range) {
+                std::size_t begin = range * rangeSize;
+                std::size_t best = bestSegment(data, begin, std::min(data.size(), begin + rangeSize), fragments);
+                if (best == data.size())
+                    continue;
+                dictionary.append(data, best, SEGMENT);
+                for (std::size_t i = best; i + FRAGMENT <= best + SEGMENT; ++i)
+                    fragments[fragmentAt(data.data() + i)].samples = 0;
+            }
+            return std::make_shared<CompressionDictionary>(dictionary, codeLengths(frequencies));
+        }
+
+        /**
+         * @brief Get the content of the dictionary.
+         *
+         * @return const std::string& Bytes preceding every block.
+         */
+        const std::string& bytes() const {
+            return _bytes;
+        }
+
+        /**
+         * @brief Get the Huffman code lengths of the literals.
+         *
+         * @return const std::vector<unsigned char>& Code length of each byte value.
+         */
+        const std::vector<unsigned char>& codeLengths() const {
+            return _lengths;
+        }
+
+        /**
+         * @brief Get the memory used by the dictionary, its match index and its literal code.
+         *
+         * @return std::size_t Bytes.
+         */
+        std::size_t memoryBytes() const {
+            return sizeof(CompressionDictionary) + _bytes.capacity() + (_head.capacity() + _chain.capacity()) * sizeof(std::int32_t)
+                + _lengths.capacity() + (_codes.capacity() + _decode.capacity()) * sizeof(std::uint16_t);
+        }
+
+        /**
+         * @brief Compress a block against the dictionary.
+         *
+         * @param block Uncompressed bytes.
+         * @return std::string Compressed bytes, see decompress().
+         */
+        std::string compress(const std::string& block) const {
+            const std::size_t size = block.size();
+            const char* data = block.data();
+            std::vector<std::int32_t> head(HASH_SIZE, -1);
+            std::vector<std::int32_t> chain(size, -1);
+            std::string sequences;
+            BitWriter literals;
+            std::size_t anchor = 0;
+            std::size_t i = 0;
+
+            while (i + MIN_MATCH <= size) {
+                std::uint32_t h = hash(data + i);
+                std::size_t bestLength = 0;
+                std::size_t bestOffset = 0;
+
+                // Matches in the block first (closer), then in the dictionary, the stream continuing into the block.
+                int depth = 0;
+                for (std::int32_t candidate = head[h]; candidate >= 0 && depth < MAX_CHAIN; candidate = chain[candidate], ++depth) {
+                    if (i - candidate > MAX_OFFSET)
+                        break;
+                    std::size_t length = matchLength(data + candidate, data + i, size - i);
+                    if (length > bestLength) {
+                        bestLength = length;
+                        bestOffset = i - candidate;
+                    }
+                }
+                depth = 0;
+                for (std::int32_t candidate = _head[h]; candidate >= 0 && depth < MAX_CHAIN; candidate = _chain[candidate], ++depth) {
+                    std::size_t offset = _bytes.size() - candidate + i;
+                    if (offset > MAX_OFFSET)
+                        break;
+                    std::size_t length = matchLength(_bytes.data() + candidate, data + i, std::min(size - i, _bytes.size() - candidate));
+                    if (length == _bytes.size() - candidate)
+                        length += matchLength(data, data + i + length, size - i - length);
+                    if (length > bestLength) {
+                        bestLength = length;
+                        bestOffset = offset;
+                    }
+                }
+
+                chain[i] = head[h];
+                head[h] = static_cast<std::int32_t>(i);
+                if (bestLength < MIN_MATCH) {
+                    ++i;
+                    continue;
+                }
+                writeSequence(sequences, literals, data + anchor, i - anchor, bestOffset, bestLength);
+                for (std::size_t next = i + 1; next < i + bestLength && next + MIN_MATCH <= size; ++next) {
+                    std::uint32_t nextHash = hash(data + next);
+                    chain[next] = head[nextHash];
+                    head[nextHash] = static_cast<std::int32_t>(next);
+                }
+                i += bestLength;
+                anchor = i;
+            }
+            writeSequence(sequences, literals, data + anchor, size - anchor, 0, 0);
+
+            std::string out;
+            writeLength(out, sequences.size());
+            out += sequences;
+            out += literals.finish();
+            out.shrink_to_fit(); // kept for the lifetime of the catalog
+            return out;
+        }
+
+        /**
+         * @brief Decompress a block compressed by compress().
+         *
+         * @param compressed Compressed bytes.
+         * @param size Size of the uncompressed block.
+         * @param block Destination, replaced.
+         * @return true if decompressed, false if the data is malformed or does not have `size` bytes.
+         */
+        bool decompress(const std::string& compressed, std::size_t size, std::string& block) const {
+            const unsigned char* in = reinterpret_cast<const unsigned char*>(compressed.data());
+            const unsigned char* end = in + compressed.size();
+            std::size_t sequenceBytes = 0;
+            std::size_t written = 0;
+
+            if (!readLength(in, end, sequenceBytes) || sequenceBytes > static_cast<std::size_t>(end - in))
+                return false;
+            BitReader literals(in + sequenceBytes, end);
+            end = in + sequenceBytes;
+            block.resize(size);
+            char* out = size ? &block[0] : nullptr;
+            while (in < end) {
+                unsigned token = *in++;
+                std::size_t count = token >> 4;
+                if ((count == 15 && !readLength(in, end, count)) || count > size - written)
+                    return false;
+                for (std::size_t l = 0; l < count; ++l) {
+                    std::uint16_t entry = _decode[literals.peek(MAX_CODE_LENGTH)];
+                    if (!literals.skip(entry & 15))
+                        return false;
+                    out[written++] = static_cast<char>(entry >> 4);
+                }
+                if (in == end)
+                    break;
+
+                std::size_t length = (token & 15) + MIN_MATCH;
+                if (end - in < 2)
+                    return false;
+                std::size_t offset = in[0] | (static_cast<std::size_t>(in[1]) << 8);
+                in += 2;
+                if (((token & 15) == 15 && !readLength(in, end, length)) || offset == 0 || offset > written + _bytes.size() || length > size - written)
+                    return false;
+                std::size_t from = _bytes.size() + written - offset;
+                if (from < _bytes.size()) {
+                    std::size_t chunk = std::min(length, _bytes.size() - from);
+                    std::memcpy(out + written, _bytes.data() + from, chunk);
+                    written += chunk;
+                    length -= chunk;
+                    from += chunk;
+                    if (!length)
+                        continue;
+                }
+                from -= _bytes.size();
+                if (offset >= length) {
+                    std::memcpy(out + written, out + from, length);
+                    written += length;
+                } else {
+                    while (length--)
+                        out[written++] = out[from++]; // overlapping copy repeats the last `offset` bytes
+                }
+            }
+            return written == size;
+        }
+
+        /**
+         * @brief Get the FNV-1a 64 hash of the content and literal code, to match catalogs with their dictionary.
+         *
+         * @return std::uint64_t Content hash.
+         */
+        std::uint64_t contentHash() const {
+            std::uint64_t value = Binary::fnv1a(Binary::FNV_OFFSET_BASIS, _bytes.data(), _bytes.size());
+
+            for (std::size_t i = 0; i < _lengths.size(); ++i)
+                value = Binary::fnv1a(value, _lengths[i]);
+            return value;
+        }
+
+        /**
+         * @brief Serialize the dictionary: "I18Y", version byte, the 256 literal code lengths, varint size, then the bytes.
+         *
+         * @param out Destination stream, opened in binary mode.
+         */
+        void write(std::ostream& out) const {
+            out.write("I18Y", 4);
+            out.put(static_cast<char>(BINARY_VERSION));
+            out.write(reinterpret_cast<const char*>(&_lengths[0]), static_cast<std::streamsize>(_lengths.size()));
+            Binary::writeVarint(out, _bytes.size());
+            out.write(_bytes.data(), static_cast<std::streamsize>(_bytes.size()));
+        }
+
+        /**
+         * @brief Parse a dictionary written by write().
+         *
+         * @param in Source stream, opened in binary mode.
+         * @return std::shared_ptr<const CompressionDictionary> Dictionary, nullptr if truncated or malformed.
+         */
+        static std::shared_ptr<const CompressionDictionary> read(std::istream& in) {
+            char magic[5] = {0};
+            std::vector<unsigned char> lengths(256, 0);
+            std::uint64_t size = 0;
+
+            if (!in.read(magic, 5) || std::string(magic, 4) != "I18Y" || magic[4] != static_cast<char>(BINARY_VERSION))
+                return nullptr;
+            if (!in.read(reinterpret_cast<char*>(&lengths[0]), 256) || !completeCode(lengths))
+                return nullptr;
+            if (!Binary::readVarint(in, size) || size > MAX_CAPACITY)
+                return nullptr;
+            std::string bytes(static_cast<std::size_t>(size), '\0');
+            if (size && !in.read(&bytes[0], static_cast<std::streamsize>(size)))
+                return nullptr;
+            return std::make_shared<CompressionDictionary>(bytes, lengths);
+        }
+
+    private:
+        static const std::size_t MIN_MATCH = 4;
+        static const std::size_t MAX_OFFSET = 65535;
+        static const int MAX_CHAIN = 16;
+        static const unsigned HASH_BITS = 13;
+        static const std::size_t HASH_SIZE = static_cast<std::size_t>(1) << HASH_BITS;
+        static const unsigned MAX_CODE_LENGTH = 12;
+        static const std::size_t FRAGMENT = 6;      // bytes of the fragments scored when training
+        static const std::size_t SEGMENT = 48;      // bytes of the segments the dictionary is made of
+
+        /**
+         * @brief Training score of a fragment: samples containing it, 0 once in the dictionary.
+         */
+        struct Fragment {
+            std::size_t samples;
+            std::size_t lastSample;     // last sample counted, plus one
+        };
+
+        /**
+         * @brief Appends codes most significant bit first.
+         */
+        class BitWriter {
+
+            public:
+
+                void write(std::uint32_t code, unsigned length) {
+                    _buffer = (_buffer << length) | code;
+                    _count += length;
+                    while (_count >= 8) {
+                        _count -= 8;
+                        _bytes += static_cast<char>((_buffer >> _count) & 0xFF);
+                    }
+                }
+
+                const std::string& finish() {
+                    if (_count)
+                        _bytes += static_cast<char>((_buffer << (8 - _count)) & 0xFF);
+                    _count = 0;
+                    return _bytes;
+                }
+
+            private:
+                std::string _bytes;
+                std::uint64_t _buffer = 0;
+                unsigned _count = 0;
+
+        };
+
+        /**
+         * @brief Reads codes most significant bit first, zeros past the end.
+         */
+        class BitReader {
+
+            public:
+
+                BitReader(const unsigned char* in, const unsigned char* end) : _in(in), _end(end) {}
+
+                std::uint32_t peek(unsigned length) {
+                    while (_count <= 56 && _in < _end) {
+                        _buffer |= static_cast<std::uint64_t>(*_in++) << (56 - _count);
+                        _count += 8;
+                    }
+                    return static_cast<std::uint32_t>(_buffer >> (64 - length));
+                }
+
+                bool skip(unsigned length) {
+                    if (length > _count)
+                        return false;
+                    _buffer <<= length;
+                    _count -= length;
+                    return true;
+                }
+
+            private:
+                const unsigned char* _in;
+                const unsigned char* _end;
+                std::uint64_t _buffer = 0;
+                unsigned _count = 0;
+
+        };
+
+    private:
+        std::string _bytes;
+        std::vector<std::int32_t> _head;        // hash of 4 bytes -> last dictionary position
+        std::vector<std::int32_t> _chain;       // dictionary position -> previous position with the same hash
+        std::vector<unsigned char> _lengths;    // literal -> code length
+        std::vector<std::uint16_t> _codes;      // literal -> canonical code
+        std::vector<std::uint16_t> _decode;     // next MAX_CODE_LENGTH bits -> literal << 4 | code length
+
+    private:
+        void index() {
+            _head.assign(HASH_SIZE, -1);
+            for (std::size_t i = 0; i + MIN_MATCH <= _bytes.size(); ++i) {
+                std::uint32_t h = hash(_bytes.data() + i);
+                _chain.push_back(_head[h]);
+                _head[h] = static_cast<std::int32_t>(i);
+            }
+        }
+
+        /**
+         * @brief Assign canonical codes, shortest first then by byte value, and fill the decoding table.
+         */
+        void buildCode(const std::vector<unsigned char>& lengths) {
+            std::uint32_t code = 0;
+
+            _lengths = lengths;
+            _codes.assign(256, 0);
+            _decode.assign(static_cast<std::size_t>(1) << MAX_CODE_LENGTH, 0);
+            for (unsigned length = 1; length <= MAX_CODE_LENGTH; ++length, code <<= 1) {
+                for (unsigned literal = 0; literal < 256; ++literal) {
+                    if (_lengths[literal] != length)
+                        continue;
+                    _codes[literal] = static_cast<std::uint16_t>(code);
+                    std::uint32_t first = code << (MAX_CODE_LENGTH - length);
+                    std::uint32_t last = (code + 1) << (MAX_CODE_LENGTH - length);
+                    for (std::uint32_t prefix = first; prefix < last; ++prefix)
+                        _decode[prefix] = static_cast<std::uint16_t>(literal << 4 | length);
+                    ++code;
+                }
+            }
+        }
+
+        /**
+         * @brief Check that code lengths form a complete prefix code within MAX_CODE_LENGTH bits.
+         */
+        static bool completeCode(const std::vector<unsigned char>& lengths) {
+            std::uint32_t used = 0;
+
+            for (std::size_t literal = 0; literal < lengths.size(); ++literal) {
+                if (lengths[literal] == 0 || lengths[literal] > MAX_CODE_LENGTH)
+                    return false;
+                used += static_cast<std::uint32_t>(1) << (MAX_CODE_LENGTH - lengths[literal]);
+            }
+            return used == static_cast<std::uint32_t>(1) << MAX_CODE_LENGTH;
+        }
+
+        /**
+         * @brief Huffman code lengths of the 256 byte values, every value coded, at most MAX_CODE_LENGTH bits.
+         *
+         * Too deep a tree is rebuilt with flattened frequencies until it fits.
+         */
+        static std::vector<unsigned char> codeLengths(std::vector<std::uint64_t> frequencies) {
+            for (;;) {
+                std::vector<std::size_t> parents(2 * 256 - 1, 0);
+                std::vector<std::pair<std::uint64_t, std::size_t> > heap;
+                for (std::size_t literal = 0; literal < 256; ++literal) // every byte value gets a code
+                    heap.push_back(std::make_pair(frequencies[literal] + 1, literal));
+                std::greater<std::pair<std::uint64_t, std::size_t> > order;
+                std::make_heap(heap.begin(), heap.end(), order);
+                for (std::size_t node = 256; heap.size() > 1; ++node) {
+                    std::pop_heap(heap.begin(), heap.end(), order);
+                    std::pair<std::uint64_t, std::size_t> a = heap.back();
+                    heap.pop_back();
+                    std::pop_heap(heap.begin(), heap.end(), order);
+                    std::pair<std::uint64_t, std::size_t> b = heap.back();
+                    heap.pop_back();
+                    parents[a.second] = node;
+                    parents[b.second] = node;
+                    heap.push_back(std::make_pair(a.first + b.first, node));
+                    std::push_heap(heap.begin(), heap.end(), order);
+                }
+
+                std::vector<unsigned char> lengths(256, 0);
+                bool fits = true;
+                for (std::size_t literal = 0; literal < 256 && fits; ++literal) {
+                    unsigned depth = 0;
+                    for (std::size_t node = literal; node != 2 * 256 - 2; node = parents[node])
+                        ++depth;
+                    lengths[literal] = static_cast<unsigned char>(depth);
+                    fits = depth <= MAX_CODE_LENGTH;
+                }
+                if (fits)
+                    return lengths;
+                for (std::size_t literal = 0; literal < 256; ++literal)
+                    frequencies[literal] /= 2;
+            }
+        }
+
+        static std::uint32_t hash(const char* data) {
+            std::uint32_t value = 0;
+
+            std::memcpy(&value, data, sizeof(value));
+            return (value * 2654435761u) >> (32 - HASH_BITS);
+        }
+
+        static std::uint64_t fragmentAt(const char* data) {
+            std::uint64_t value = 0;
+
+            std::memcpy(&value, data, FRAGMENT);
+            return value;
+        }
+
+        static std::size_t matchLength(const char* a, const char* b, std::size_t limit) {
+            std::size_t length = 0;
+
+            while (length < limit && a[length] == b[length])
+                ++length;
+            return length;
+        }
+
+        /**
+         * @brief Find the segment of [begin, end) containing the most valuable distinct fragments.
+         *
+         * @return std::size_t Start of the segment, data.size() if nothing scores.
+         */
+        static std::size_t bestSegment(const std::string& data, std::size_t begin, std::size_t end,
+                                       std::unordered_map<std::uint64_t, Fragment>& fragments) {
+            std::unordered_map<std::uint64_t, std::size_t> window; // fragment -> occurrences in the window
+            std::size_t score = 0;
+            std::size_t bestScore = 0;
+            std::size_t best = data.size();
+            const std::size_t span = SEGMENT - FRAGMENT + 1;  // fragments starting in a segment
+
+            for (std::size_t i = begin; i + FRAGMENT <= end && i + FRAGMENT <= data.size(); ++i) {
+                std::uint64_t added = fragmentAt(data.data() + i);
+                if (window[added]++ == 0)
+                    score += fragments[added].samples;
+                if (i >= begin + span) {
+                    std::uint64_t removed = fragmentAt(data.data() + i - span);
+                    if (--window[removed] == 0)
+                        score -= fragments[removed].samples;
+                }
+                if (i + 1 >= begin + span && score > bestScore && i + 1 - span + SEGMENT <= data.size()) {
+                    bestScore = score;
+                    best = i + 1 - span;
+                }
+            }
+            return bestScore > 1 ? best : data.size(); // a fragment of a single sample is worth nothing
+        }
+
+        static void writeLength(std::string& out, std::size_t length) {
+            for (; length >= 255; length -= 255)
+                out += static_cast<char>(255);
+            out += static_cast<char>(length);
+        }
+
+        /**
+         * @brief Read a length continued in 255-valued bytes, added to `length`.
+         */
+        static bool readLength(const unsigned char*& in, const unsigned char* end, std::size_t& length) {
+            for (;;) {
+                if (in == end)
+                    return false;
+                unsigned byte = *in++;
+                length += byte;
+                if (byte != 255)
+                    return true;
+            }
+        }
+
+        /**
+         * @brief Append the literals to the bit stream, then the sequence; no match (length 0) for the last sequence.
+         */
+        void writeSequence(std::string& sequences, BitWriter& literals, const char* text, std::size_t count, std::size_t offset, std::size_t length) const {
+            std::size_t matchCode = length ? length - MIN_MATCH : 0;
+
+            sequences += static_cast<char>((std::min<std::size_t>(count, 15) << 4) | std::min<std::size_t>(matchCode, 15));
+            if (count >= 15)
+                writeLength(sequences, count - 15);
+            for (std::size_t i = 0; i < count; ++i) {
+                unsigned char literal = static_cast<unsigned char>(text[i]);
+                literals.write(_codes[literal], _lengths[literal]);
+            }
+            if (!length)
+                return;
+            sequences += static_cast<char>(offset & 0xFF);
+            sequences += static_cast<char>(offset >> 8);
+            if (matchCode >= 15)
+                writeLength(sequences, matchCode - 15);
+        }
+
+};
+
+/**
+ * @brief Counters of a CompressedCatalog block cache.
+ */
+struct CompressedCatalogStats {
+    std::uint64_t hits;             ///< Lookups answered from a decompressed block.
+    std::uint64_t misses;           ///< Lookups that decompressed their block.
+    std::uint64_t evictions;        ///< Blocks dropped to respect the capacity.
+    std::size_t residentBlocks;     ///< Blocks currently decompressed.
+    std::size_t residentBytes;      ///< Bytes of the decompressed blocks.
+
+    /**
+     * @brief Get the share of lookups answered without decompressing.
+     *
+     * @return double Hits over lookups, 0 before the first lookup.
+     */
+    double hitRate() const {
+        return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(hits + misses);
+    }
+};
+
+/**
+ * @brief Read-only catalog kept compressed, its blocks decompressed on demand into a bounded cache.
+ *
+ * The strings are concatenated in key order and cut in blocks of about
+ * `blockBytes`, each compressed against a CompressionDictionary shared by the
+ * catalogs of every language. A lookup decompresses the block of its key on
+ * first use and keeps it in a least recently used cache of `cacheBlocks`
+ * blocks: strings never read are never decompressed, and the memory of a
+ * locale stays bounded whatever its size. The key index is the end offset
+ * of each string in that concatenation, 4 bytes and a bit per key.
+ *
+ * Binary format (write() / read()): "I18Z", version byte, dictionary content
+ * hash (64-bit little-endian), then the language code, the key count, the
+ * block count, each block as its uncompressed size and compressed bytes, and
+ * each key as its string size plus one (0 when missing), strings being in key
+ * order. Integers are unsigned LEB128 varints, as in CatalogExporter.
+ *
+ * Example usage:
+ * @code
+ * std::shared_ptr<const CompressedCatalog> fr(new CompressedCatalog(*frCatalog, dictionary));
+ * context.setSupportedCompressedCatalog<LocaleCompressed>(fr);
+ * fr->text(SignInTitle); // "Connexion", its block decompressed now
+ * @endcode
+ *
+ * @note Lookups are thread-safe, the cache is locked. Text is returned by
+ * value: a block may be evicted once the lookup returns.
+ *
+ * @see CompressedLocale
+ */
+class CompressedCatalog {
+
+    public:
+
+        /**
+         * @brief Uncompressed block size used when none is given.
+         */
+        static const std::size_t DEFAULT_BLOCK_BYTES = 1024;
+
+        /**
+         * @brief Number of decompressed blocks kept when none is given.
+         */
+        static const std::size_t DEFAULT_CACHE_BLOCKS = 16;
+
+        /**
+         * @brief Version byte written after the magic of the binary format.
+         */
+        static const unsigned char BINARY_VERSION = 1;
+
+        /**
+         * @brief Compress the strings of a catalog.
+         *
+         * @param catalog Strings to compress, inherited ones included.
+         * @param dictionary Dictionary shared with the other languages, must not be null.
+         * @param blockBytes Uncompressed size after which a block is closed.
+         * @param cacheBlocks Maximum number of decompressed blocks, at least 1.
+         */
+        CompressedCatalog(const Catalog& catalog, std::shared_ptr<const CompressionDictionary> dictionary,
+                          std::size_t blockBytes = DEFAULT_BLOCK_BYTES, std::size_t cacheBlocks = DEFAULT_CACHE_BLOCKS)
+            : _code(catalog.languageCode()), _dictionary(dictionary), _cacheBlocks(std::max<std::size_t>(1, cacheBlocks)) {
+            std::string block;
+
+            _ends.reserve(catalog.size());
+            _defined.reserve(catalog.size());
+            for (std::size_t key = 0; key < catalog.size(); ++key) {
+                const std::string* value = catalog.find(key);
+                if (value)
+                    block += *value;
+                _ends.push_back(static_cast<std::uint32_t>(uncompressedBytes() + block.size()));
+                _defined.push_back(value != nullptr);
+                if (!block.empty() && block.size() >= blockBytes)
+                    closeBlock(block);
+            }
+            if (!block.empty())
+                closeBlock(block);
+            _resident.assign(_blocks.size(), 0);
+        }
+
+        /**
+         * @brief Get the language code of the catalog.
+         *
+         * @return const std::string& Language code.
+         */
+        const std::string& languageCode() const {
+            return _code;
+        }
+
+        /**
+         * @brief Get the number of keys.
+         *
+         * @return std::size_t Key count, defined or not.
+         */
+        std::size_t size() const {
+            return _ends.size();
+        }
+
+        /**
+         * @brief Get the dictionary the blocks are compressed against.
+         *
+         * @return const std::shared_ptr<const CompressionDictionary>& Shared dictionary.
+         */
+        const std::shared_ptr<const CompressionDictionary>& dictionary() const {
+            return _dictionary;
+        }
+
+        /**
+         * @brief Get the number of blocks.
+         *
+         * @return std::size_t Block count.
+         */
+        std::size_t blockCount() const {
+            return _blocks.size();
+        }
+
+        /**
+         * @brief Get the size of the strings once decompressed.
+         *
+         * @return std::size_t Bytes of every defined string.
+         */
+        std::size_t uncompressedBytes() const {
+            return _blocks.empty() ? 0 : _blocks.back().end;
+        }
+
+        /**
+         * @brief Get the size of the compressed catalog, cache and shared dictionary excluded.
+         *
+         * @return std::size_t Bytes of the compressed blocks and of the key index.
+         */
+        std::size_t compressedBytes() const {
+            std::size_t bytes = sizeof(CompressedCatalog) + (_ends.capacity() + _resident.capacity()) * sizeof(std::uint32_t)
+                + (_defined.capacity() + 7) / 8 + _blocks.capacity() * sizeof(Block);
+
+            for (std::size_t i = 0; i < _blocks.size(); ++i)
+                bytes += _blocks[i].data.capacity();
+            return bytes;
+        }
+
+        /**
+         * @brief Get the maximum number of decompressed blocks.
+         *
+         * @return std::size_t Cache capacity, in blocks.
+         */
+        std::size_t cacheCapacity() const {
+            return _cacheBlocks;
+        }
+
+        /**
+         * @brief Check whether a key has a string, without decompressing.
+         *
+         * @param key Key index, must be lower than size().
+         * @return true if defined.
+         */
+        bool contains(std::size_t key) const {
+            return _defined[key];
+        }
+
+        /**
+         * @brief Look up a string, decompressing its block if it is not cached.
+         *
+         * @param key Key index, must be lower than size().
+         * @return std::string Translated string, empty if missing or if the block is corrupted.
+         */
+        std::string text(std::size_t key) const {
+            std::uint32_t begin = key ? _ends[key - 1] : 0;
+
+            if (_ends[key] == begin)
+                return std::string();
+            // Strings do not span blocks: the block of a string is the first one ending after its start.
+            std::size_t index = std::upper_bound(_blocks.begin(), _blocks.end(), begin, endsBefore) - _blocks.begin();
+            std::shared_ptr<const std::string> block = residentBlock(index);
+            if (!block)
+                return std::string();
+            return block->substr(begin - (index ? _blocks[index - 1].end : 0), _ends[key] - begin);
+        }
+
+        /**
+         * @brief Get the counters of the block cache.
+         *
+         * @return CompressedCatalogStats Snapshot of the counters.
+         */
+        CompressedCatalogStats stats() const {
+            std::lock_guard<std::mutex> lock(_mutex);
+            CompressedCatalogStats stats = _stats;
+
+            stats.residentBytes = 0;
+            for (std::size_t i = 0; i < _slots.size(); ++i)
+                stats.residentBytes += _slots[i].data->size();
+            stats.residentBlocks = _slots.size();
+            return stats;
+        }
+
+        /**
+         * @brief Drop every decompressed block, e.g. on memory pressure.
+         */
+        void releaseCache() const {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            _slots.clear();
+            std::fill(_resident.begin(), _resident.end(), 0);
+        }
+
+        /**
+         * @brief Serialize the catalog in the binary format, the dictionary is written separately.
+         *
+         * @param out Destination stream, opened in binary mode.
+         */
+        void write(std::ostream& out) const {
+            std::uint64_t hash = _dictionary->contentHash();
+
+            out.write("I18Z", 4);
+            out.put(static_cast<char>(BINARY_VERSION));
+            for (int i = 0; i < 8; ++i)
+                out.put(static_cast<char>((hash >> (8 * i)) & 0xFF));
+            Binary::writeVarint(out, _code.size());
+            out.write(_code.data(), static_cast<std::streamsize>(_code.size()));
+            Binary::writeVarint(out, _ends.size());
+            Binary::writeVarint(out, _blocks.size());
+            for (std::size_t i = 0; i < _blocks.size(); ++i) {
+                Binary::writeVarint(out, blockSize(i));
+                Binary::writeVarint(out, _blocks[i].data.size());
+                out.write(_blocks[i].data.data(), static_cast<std::streamsize>(_blocks[i].data.size()));
+            }
+            for (std::size_t key = 0; key < _ends.size(); ++key)
+                Binary::writeVarint(out, _defined[key] ? _ends[key] - (key ? _ends[key - 1] : 0) + 1ULL : 0);
+        }
+
+        /**
+         * @brief Parse a catalog written by write(), without decompressing it.
+         *
+         * @param in Source stream, opened in binary mode.
+         * @param dictionary Dictionary the catalog was compressed against.
+         * @param cacheBlocks Maximum number of decompressed blocks, at least 1.
+         * @return std::shared_ptr<const CompressedCatalog> Catalog, nullptr if truncated, malformed or for another dictionary.
+         */
+        static std::shared_ptr<const CompressedCatalog> read(std::istream& in, std::shared_ptr<const CompressionDictionary> dictionary,
+                                                             std::size_t cacheBlocks = DEFAULT_CACHE_BLOCKS) {
+            char header[13] = {0};
+            std::uint64_t hash = 0;
+            std::uint64_t codeSize = 0;
+            std::uint64_t keyCount = 0;
+            std::uint64_t blockCount = 0;
+
+            if (!dictionary || !in.read(header, 13) || std::string(header, 4) != "I18Z" || header[4] != static_cast<char>(BINARY_VERSION))
+                return nullptr;
+            for (int i = 0; i < 8; ++i)
+                hash |= static_cast<std::uint64_t>(static_cast<unsigned char>(header[5 + i])) << (8 * i);
+            if (hash != dictionary->contentHash() || !Binary::readVarint(in, codeSize) || codeSize > MAX_CODE)
+                return nullptr;
+
+            std::shared_ptr<CompressedCatalog> catalog(new CompressedCatalog(dictionary, cacheBlocks));
+            catalog->_code.resize(static_cast<std::size_t>(codeSize));
+            if ((codeSize && !in.read(&catalog->_code[0], static_cast<std::streamsize>(codeSize)))
+                || !Binary::readVarint(in, keyCount) || !Binary::readVarint(in, blockCount))
+                return nullptr;
+            // Grow with the data actually read, a corrupted count must not allocate it all upfront.
+            std::uint64_t end = 0;
+            for (std::uint64_t i = 0; i < blockCount; ++i) {
+                Block block = {std::string(), 0};
+                std::uint64_t size = 0;
+                std::uint64_t compressed = 0;
+                if (!Binary::readVarint(in, size) || size == 0 || size > MAX_BYTES - end || !Binary::readVarint(in, compressed) || compressed > MAX_BYTES)
+                    return nullptr;
+                end += size;
+                block.end = static_cast<std::uint32_t>(end);
+                if (!Binary::readBytes(in, compressed, block.data))
+                    return nullptr;
+                catalog->_blocks.push_back(block);
+            }
+            end = 0;
+            std::size_t block = 0;
+            for (std::uint64_t key = 0; key < keyCount; ++key) {
+                std::uint64_t size = 0;
+                if (!Binary::readVarint(in, size) || size > catalog->uncompressedBytes() - end + 1)
+                    return nullptr;
+                std::uint64_t begin = end;
+                end += size ? size - 1 : 0;
+                while (block < catalog->_blocks.size() && catalog->_blocks[block].end <= begin)
+                    ++block;
+                if (end > begin && end > catalog->_blocks[block].end) // a string must end in the block it starts in
+                    return nullptr;
+                catalog->_ends.push_back(static_cast<std::uint32_t>(end));
+                catalog->_defined.push_back(size != 0);
+            }
+            if (end != catalog->uncompressedBytes())
+                return nullptr;
+            catalog->_resident.assign(catalog->_blocks.size(), 0);
+            return catalog;
+        }
+
+    private:
+        static const std::uint64_t MAX_CODE = 255;
+        static const std::uint64_t MAX_BYTES = 0xFFFFFFFFu;
+
+        /**
+         * @brief Compressed block and the end of its strings in the uncompressed catalog.
+         */
+        struct Block {
+            std::string data;
+            std::uint32_t end;
+        };
+
+        /**
+         * @brief Decompressed block of the cache.
+         */
+        struct Slot {
+            std::size_t block;
+            std::shared_ptr<const std::string> data;
+            std::uint64_t lastUse;
+        };
+
+    private:
+        std::string _code;
+        std::shared_ptr<const CompressionDictionary> _dictionary;
+        std::vector<std::uint32_t> _ends;       // key -> end of its string in the uncompressed catalog, strings in key order
+        std::vector<bool> _defined;             // key -> has a string
+        std::vector<Block> _blocks;
+        std::size_t _cacheBlocks;
+        mutable std::mutex _mutex;
+        mutable std::vector<Slot> _slots;               // decompressed blocks, at most _cacheBlocks
+        mutable std::vector<std::uint32_t> _resident;   // block -> slot + 1, 0 when compressed only
+        mutable std::uint64_t _clock = 0;
+        mutable CompressedCatalogStats _stats = CompressedCatalogStats();
+
+    private:
+        /**
+         * @brief Build an empty catalog, see read().
+         */
+        CompressedCatalog(std::shared_ptr<const CompressionDictionary> dictionary, std::size_t cacheBlocks)
+            : _dictionary(dictionary), _cacheBlocks(std::max<std::size_t>(1, cacheBlocks)) {}
+
+        void closeBlock(std::string& block) {
+            Block compressed = {_dictionary->compress(block), static_cast<std::uint32_t>(uncompressedBytes() + block.size())};
+
+            _blocks.push_back(compressed);
+            block.clear();
+        }
+
+        std::size_t blockSize(std::size_t block) const {
+            return _blocks[block].end - (block ? _blocks[block - 1].end : 0);
+        }
+
+        static bool endsBefore(std::uint32_t position, const Block& block) {
+            return position < block.end;
+        }
+
+        /**
+         * @brief Get a decompressed block, decompressing it in place of the least recently used one if needed.
+         *
+         * @return std::shared_ptr<const std::string> Block, nullptr if corrupted.
+         */
+        std::shared_ptr<const std::string> residentBlock(std::size_t block) const {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            if (_resident[block]) {
+                Slot& slot = _slots[_resident[block] - 1];
+                slot.lastUse = ++_clock;
+                ++_stats.hits;
+                return slot.data;
+            }
+
+            std::shared_ptr<std::string> data = std::make_shared<std::string>();
+            if (!_dictionary->decompress(_blocks[block].data, blockSize(block), *data))
+                return nullptr;
+            ++_stats.misses;
+            Slot fresh = {block, data, ++_clock};
+            if (_slots.size() < _cacheBlocks) {
+                _slots.push_back(fresh);
+                _resident[block] = static_cast<std::uint32_t>(_slots.size());
+                return data;
+            }
+            std::size_t victim = 0;
+            for (std::size_t i = 1; i < _slots.size(); ++i)
+                if (_slots[i].lastUse < _slots[victim].lastUse)
+                    victim = i;
+            _resident[_slots[victim].block] = 0;
+            _slots[victim] = fresh;
+            _resident[block] = static_cast<std::uint32_t>(victim + 1);
+            ++_stats.evictions;
+            return data;
+        }
+
+};
@@ -0,0 +1,87 @@
+/**
+ * @file CompressedLocale.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <memory>
+#include <cstddef>
+#include <type_traits>
+
+#include "ILocale.hpp"
+#include "TypeTraits.hpp"
+#include "CompressedCatalog.hpp"
+
+/**
+ * @brief Locale implementation reading its strings from a CompressedCatalog.
+ *
+ * Implements `languageCode()` from the catalog, the concrete locale only maps
+ * each getter of the interface to a key index, as with CatalogLocale. The
+ * block holding a string is decompressed the first time one of its keys is
+ * read.
+ *
+ * Example usage:
+ * @code
+ * class LocaleCompressed : public CompressedLocale<DefaultLocale> {
+ * public:
+ *     using CompressedLocale<DefaultLocale>::CompressedLocale;
+ *     const std::string getSignUpTitle() const override { return text(SignUpTitle); }
+ *     const std::string getSignInTitle() const override { return text(SignInTitle); }
+ * };
+ *
+ * context.setSupportedCompressedCatalog<LocaleCompressed>(compressed);
+ * @endcode
+ *
+ * @tparam T is the base locale interface derived from ILocale.
+ *
+ * @see I18nContext::setSupportedCompressedCatalog
+ */
+template<typename T, typename = typename std::enable_if<is_derived_from<T, ILocale>::value>::type>
+class CompressedLocale : public T {
+
+    public:
+
+        /**
+         * @brief Build the locale over a compressed catalog.
+         *
+         * @param catalog Strings of the locale, shared and never modified.
+         */
+        explicit CompressedLocale(std::shared_ptr<const CompressedCatalog> catalog) : _catalog(catalog) {}
+
+        /**
+         * @brief Retrieve the language code of the catalog.
+         *
+         * @return std::string Language code.
+         */
+        const std::string languageCode() const override {
+            return _catalog->languageCode();
+        }
+
+        /**
+         * @brief Get the catalog backing the locale.
+         *
+         * @return const std::shared_ptr<const CompressedCatalog>& Compressed catalog.
+         */
+        const std::shared_ptr<const CompressedCatalog>& catalog() const {
+            return _catalog;
+        }
+
+    protected:
+        /**
+         * @brief Look up a string of the catalog, decompressing its block if needed.
+         *
+         * @param key Key index.
+         * @return std::string Translated string, empty if missing.
+         */
+        std::string text(std::size_t key) const {
+            return _catalog->text(key);
+        }
+
+    private:
+        std::shared_ptr<const CompressedCatalog> _catalog;
+
+};
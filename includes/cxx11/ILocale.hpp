@@ -8,6 +8,11 @@
 #pragma once
 
 #include <string>
+#include <atomic>
+#include <cstddef>
+
+#include "CaseMap.hpp"
+#include "Collator.hpp"
 
 /**
  * @brief Base interface for all locale implementations.
@@ -43,8 +48,68 @@ public:
      */
     virtual const std::string languageCode() const = 0;
 
+    /**
+     * @brief Retrieve the case mapping rules of the language, for toLower/toUpper/fold.
+     *
+     * @note Keep the reference when mapping many strings, the lookup takes a lock.
+     *
+     * @return const CaseMap& Case map of languageCode().
+     */
+    const CaseMap& caseMap() const {
+        return CaseMap::forLanguage(languageCode());
+    }
+
+    /**
+     * @brief Retrieve the collation rules of the language, to sort strings shown to the user.
+     *
+     * @note Keep the reference when comparing many strings, the lookup takes a lock.
+     *
+     * @return const Collator& Collator of languageCode().
+     */
+    const Collator& collator() const {
+        return Collator::forLanguage(languageCode());
+    }
+
+    /**
+     * @brief Get the number of locale objects alive in the process, every locale type included.
+     *
+     * @return std::size_t Live instance count.
+     */
+    static std::size_t liveCount() {
+        return liveCounter().load(std::memory_order_relaxed);
+    }
+
     /**
      * @brief Virtual destructor for proper cleanup of derived classes.
      */
-    virtual ~ILocale() = default;
+    virtual ~ILocale() {
+        liveCounter().fetch_sub(1, std::memory_order_relaxed);
+    }
+
+protected:
+    /**
+     * @brief Count the new instance, see liveCount().
+     */
+    ILocale() {
+        liveCounter().fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Count the new instance, see liveCount().
+     */
+    ILocale(const ILocale&) {
+        liveCounter().fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Assignment leaves the instance count unchanged.
+     */
+    ILocale& operator=(const ILocale&) = default;
+
+private:
+    static std::atomic<std::size_t>& liveCounter() {
+        static std::atomic<std::size_t> counter(0);
+
+        return counter;
+    }
 };
\ No newline at end of file
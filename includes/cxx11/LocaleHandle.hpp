@@ -0,0 +1,230 @@
+/**
+ * @file LocaleHandle.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <type_traits>
+
+#include "ILocale.hpp"
+#include "TypeTraits.hpp"
+
+/**
+ * @brief Shared reference to a registered locale, and the locale current on each thread.
+ *
+ * A handle shares ownership of a locale instance of an I18nContext: it is
+ * copied with the work it belongs to (a request, a task) and made current on
+ * the thread running that work, instead of reading a process-wide selection.
+ * Making a handle current stores it in a thread-local slot.
+ *
+ * Example usage:
+ * @code
+ * LocaleHandle<DefaultLocale> locale = tenant.getHandle("fr");
+ * pool.submit(bindLocale(locale, []() {
+ *     render(LocaleHandle<DefaultLocale>::current()->getSignInTitle()); // "Connexion", on any worker
+ * }));
+ * @endcode
+ *
+ * @tparam T is the base locale interface derived from ILocale.
+ *
+ * @note A reload or a re-registration replaces the instance in the context
+ * but not in live handles, scopes or suspended tasks: they keep the locale
+ * they were given until they are released.
+ *
+ * @see LocaleScope
+ * @see bindLocale
+ */
+template<typename T, typename = typename std::enable_if<is_derived_from<T, ILocale>::value>::type>
+class LocaleHandle {
+
+    public:
+
+        /**
+         * @brief Build an empty handle.
+         */
+        LocaleHandle() {}
+
+        /**
+         * @brief Build a handle to a locale instance.
+         *
+         * @param locale Registered locale, nullptr for an empty handle.
+         */
+        explicit LocaleHandle(std::shared_ptr<const T> locale) : _locale(std::move(locale)) {}
+
+        /**
+         * @brief Get the locale.
+         *
+         * @return const T* Locale instance, nullptr for an empty handle.
+         */
+        const T* get() const {
+            return _locale.get();
+        }
+
+        /**
+         * @brief Access the locale.
+         *
+         * @return const T* Locale instance, must not be empty.
+         */
+        const T* operator->() const {
+            return _locale.get();
+        }
+
+        /**
+         * @brief Check whether the handle refers to a locale.
+         *
+         * @return true if not empty.
+         */
+        explicit operator bool() const {
+            return _locale != nullptr;
+        }
+
+        /**
+         * @brief Compare the referred locales.
+         */
+        bool operator==(const LocaleHandle& other) const {
+            return _locale == other._locale;
+        }
+
+        /**
+         * @brief Compare the referred locales.
+         */
+        bool operator!=(const LocaleHandle& other) const {
+            return _locale != other._locale;
+        }
+
+        /**
+         * @brief Get the locale current on the calling thread.
+         *
+         * @return LocaleHandle Handle set by the innermost LocaleScope or setCurrent(), empty if none.
+         */
+        static LocaleHandle current() {
+            return LocaleHandle(slot());
+        }
+
+        /**
+         * @brief Make a locale current on the calling thread.
+         *
+         * @param handle New current locale, empty to clear it.
+         */
+        static void setCurrent(LocaleHandle handle) {
+            slot() = std::move(handle._locale);
+        }
+
+    private:
+        std::shared_ptr<const T> _locale;
+
+    private:
+        static std::shared_ptr<const T>& slot() {
+            static thread_local std::shared_ptr<const T> locale;
+
+            return locale;
+        }
+
+};
+
+/**
+ * @brief Makes a locale current on the calling thread for the lifetime of the scope.
+ *
+ * The previous current locale is restored on destruction, scopes nest.
+ *
+ * Example usage:
+ * @code
+ * {
+ *     LocaleScope<DefaultLocale> scope(request.locale);
+ *     handle(request); // LocaleHandle<DefaultLocale>::current() is request.locale
+ * }
+ * @endcode
+ *
+ * @tparam T is the base locale interface derived from ILocale.
+ */
+template<typename T>
+class LocaleScope {
+
+    public:
+
+        /**
+         * @brief Make `handle` current.
+         *
+         * @param handle Locale to use in the scope.
+         */
+        explicit LocaleScope(LocaleHandle<T> handle) : _previous(LocaleHandle<T>::current()) {
+            LocaleHandle<T>::setCurrent(handle);
+        }
+
+        /**
+         * @brief Restore the previous current locale.
+         */
+        ~LocaleScope() {
+            LocaleHandle<T>::setCurrent(_previous);
+        }
+
+        /**
+         * @brief delete Copy constructor
+         */
+        LocaleScope(const LocaleScope&) = delete;
+
+        /**
+         * @brief delete Copy assignment
+         */
+        LocaleScope& operator=(const LocaleScope&) = delete;
+
+    private:
+        LocaleHandle<T> _previous;
+
+};
+
+/**
+ * @brief Callable running another one with a locale current, see bindLocale().
+ *
+ * @tparam T is the base locale interface derived from ILocale.
+ * @tparam F Wrapped callable.
+ */
+template<typename T, typename F>
+class LocaleBound {
+
+    public:
+
+        /**
+         * @brief Bind a callable to a locale.
+         *
+         * @param handle Locale made current while `function` runs.
+         * @param function Wrapped callable.
+         */
+        LocaleBound(LocaleHandle<T> handle, F function) : _handle(handle), _function(std::move(function)) {}
+
+        /**
+         * @brief Run the callable with the bound locale current, then restore the thread's.
+         */
+        template<typename... A>
+        auto operator()(A&&... arguments) -> decltype(std::declval<F&>()(std::forward<A>(arguments)...)) {
+            LocaleScope<T> scope(_handle);
+
+            return _function(std::forward<A>(arguments)...);
+        }
+
+    private:
+        LocaleHandle<T> _handle;
+        F _function;
+
+};
+
+/**
+ * @brief Wrap a callable so it runs with a locale current, on whichever thread executes it.
+ *
+ * Executor adapter: submit the result to a ThreadPool or any executor taking callables.
+ *
+ * @tparam T is the base locale interface derived from ILocale.
+ * @tparam F Callable type.
+ * @param handle Locale made current while `function` runs.
+ * @param function Callable.
+ * @return LocaleBound<T, F> Callable with the same signature.
+ */
+template<typename T, typename F>
+LocaleBound<T, typename std::decay<F>::type> bindLocale(LocaleHandle<T> handle, F&& function) {
+    return LocaleBound<T, typename std::decay<F>::type>(handle, std::forward<F>(function));
+}
@@ -0,0 +1,281 @@
+/**
+ * @file MemoryReport.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <unordered_map>
+
+#include "ILocale.hpp"
+#include "Catalog.hpp"
+#include "MoFile.hpp"
+#include "CompressedCatalog.hpp"
+
+/**
+ * @brief Memory used by one registered locale.
+ *
+ * A string referenced by several locales (a layer and its parent, two
+ * snapshots of a catalog, ...) is counted in the heapBytes of the first one,
+ * in language code order, and in the sharedBytes of the others: the sum of
+ * heapBytes over a report is the heap used, without double counting.
+ */
+struct LocaleFootprint {
+    std::string languageCode;       ///< Code the locale is registered under.
+    std::size_t strings;            ///< Strings referenced, one per defined key.
+    std::size_t heapBytes;          ///< Heap owned: key table, strings and metadata first referenced by this locale.
+    std::size_t mappedBytes;        ///< File mappings (MoLocale), shared with the page cache.
+    std::size_t sharedBytes;        ///< Strings referenced here but owned by another locale of the report.
+    std::size_t internedSavings;    ///< Bytes a copy of each string per reference would add.
+};
+
+/**
+ * @brief Memory used by one key across the registered catalogs.
+ */
+struct KeyFootprint {
+    std::string name;               ///< Key name.
+    std::size_t bytes;              ///< Distinct strings of the key and their metadata.
+    std::size_t locales;            ///< Locales defining the key.
+};
+
+/**
+ * @brief Memory introspection of an I18nContext, see I18nContext::memoryReport().
+ */
+struct MemoryReport {
+    std::vector<LocaleFootprint> locales;   ///< One entry per registered locale, by language code.
+    std::vector<KeyFootprint> keys;         ///< One entry per key of the registered catalogs, in key order.
+    std::size_t liveLocales;                ///< Locale objects alive in the process, see ILocale::liveCount().
+
+    /**
+     * @brief Get the heap used by every locale of the report.
+     *
+     * @return std::size_t Sum of LocaleFootprint::heapBytes.
+     */
+    std::size_t heapBytes() const {
+        std::size_t total = 0;
+
+        for (std::size_t i = 0; i < locales.size(); ++i)
+            total += locales[i].heapBytes;
+        return total;
+    }
+
+    /**
+     * @brief Get the file mappings of every locale of the report.
+     *
+     * @return std::size_t Sum of LocaleFootprint::mappedBytes.
+     */
+    std::size_t mappedBytes() const {
+        std::size_t total = 0;
+
+        for (std::size_t i = 0; i < locales.size(); ++i)
+            total += locales[i].mappedBytes;
+        return total;
+    }
+
+    /**
+     * @brief Get the bytes saved by sharing strings instead of copying them.
+     *
+     * @return std::size_t Sum of LocaleFootprint::internedSavings.
+     */
+    std::size_t internedSavings() const {
+        std::size_t total = 0;
+
+        for (std::size_t i = 0; i < locales.size(); ++i)
+            total += locales[i].internedSavings;
+        return total;
+    }
+};
+
+/**
+ * @brief Builds a MemoryReport, one locale at a time.
+ *
+ * Walks the slot table of each catalog once, nothing is copied. Strings
+ * held by a single slot are counted directly, only the shared ones go
+ * through a hash table to be counted once. Sizes are estimates of what the
+ * allocator hands out: string objects and their buffers (none for strings
+ * short enough to be stored inline), TextMetrics tables and two words of
+ * reference counting per shared object.
+ *
+ * Example usage:
+ * @code
+ * FootprintCollector collector;
+ * collector.addCatalog("fr", *fr);
+ * collector.addCatalog("fr-CA", *frCA); // inherited strings reported as shared
+ * MemoryReport report = collector.report();
+ * @endcode
+ *
+ * @see I18nContext::memoryReport
+ */
+class FootprintCollector {
+
+    public:
+
+        /**
+         * @brief Account for a locale built over a Catalog.
+         *
+         * @param code Code the locale is registered under.
+         * @param catalog Catalog of the locale.
+         */
+        void addCatalog(const std::string& code, const Catalog& catalog) {
+            LocaleFootprint footprint = {code, 0, tableBytes(catalog), 0, 0, 0};
+            std::size_t locale = _report.locales.size();
+
+            for (std::size_t key = 0; key < catalog.size(); ++key) {
+                const std::string* value = catalog.find(key);
+                if (!value)
+                    continue;
+                std::size_t bytes = entryBytes(*value, catalog.metrics(key));
+                KeyFootprint& keyFootprint = keyOf(catalog.keys(), key);
+
+                ++footprint.strings;
+                ++keyFootprint.locales;
+                bool owned = catalog.entry(key).use_count() == 1; // held by this slot only
+                std::size_t owner = locale;
+                if (!owned) {
+                    std::pair<std::unordered_map<const std::string*, std::size_t>::iterator, bool> first
+                        = _owners.insert(std::make_pair(value, locale));
+                    owned = first.second;
+                    owner = first.first->second;
+                }
+                if (owned) {
+                    footprint.heapBytes += bytes;
+                    keyFootprint.bytes += bytes;
+                    continue;
+                }
+                footprint.internedSavings += bytes;
+                if (owner != locale)
+                    footprint.sharedBytes += bytes;
+            }
+            _report.locales.push_back(footprint);
+        }
+
+        /**
+         * @brief Account for a locale reading a gettext `.mo` file.
+         *
+         * @param code Code the locale is registered under.
+         * @param file File of the locale, mapped or read in memory.
+         */
+        void addMoFile(const std::string& code, const MoFile& file) {
+            LocaleFootprint footprint = {code, file.size(), sizeof(MoFile), 0, 0, 0};
+
+            if (file.mapped())
+                footprint.mappedBytes = file.fileSize();
+            else
+                footprint.heapBytes += file.fileSize();
+            _report.locales.push_back(footprint);
+        }
+
+        /**
+         * @brief Account for a locale reading a CompressedCatalog.
+         *
+         * The compressed blocks, the key index and the decompressed blocks
+         * of the cache are owned by the locale. The dictionary is counted in
+         * the heapBytes of the first locale using it and in the sharedBytes of
+         * the others.
+         *
+         * @param code Code the locale is registered under.
+         * @param catalog Catalog of the locale.
+         */
+        void addCompressedCatalog(const std::string& code, const CompressedCatalog& catalog) {
+            LocaleFootprint footprint = {code, 0, catalog.compressedBytes() + catalog.stats().residentBytes, 0, 0, 0};
+            const CompressionDictionary& dictionary = *catalog.dictionary();
+            std::size_t dictionaryBytes = dictionary.memoryBytes() + CONTROL_BLOCK_BYTES;
+            std::size_t locale = _report.locales.size();
+
+            for (std::size_t key = 0; key < catalog.size(); ++key)
+                footprint.strings += catalog.contains(key) ? 1 : 0;
+            std::pair<std::unordered_map<const std::string*, std::size_t>::iterator, bool> first
+                = _owners.insert(std::make_pair(&dictionary.bytes(), locale));
+            if (first.second) {
+                footprint.heapBytes += dictionaryBytes;
+            } else {
+                footprint.sharedBytes += dictionaryBytes;
+                footprint.internedSavings += dictionaryBytes;
+            }
+            _report.locales.push_back(footprint);
+        }
+
+        /**
+         * @brief Account for a compiled-in locale, its strings live in the binary.
+         *
+         * @param code Code the locale is registered under.
+         */
+        void addLocale(const std::string& code) {
+            LocaleFootprint footprint = {code, 0, 0, 0, 0, 0};
+
+            _report.locales.push_back(footprint);
+        }
+
+        /**
+         * @brief Get the report of the locales added so far.
+         *
+         * @return MemoryReport Footprints and the live locale count.
+         */
+        MemoryReport report() const {
+            MemoryReport report = _report;
+
+            report.liveLocales = ILocale::liveCount();
+            return report;
+        }
+
+    private:
+        static const std::size_t CONTROL_BLOCK_BYTES = 2 * sizeof(void*);
+
+    private:
+        MemoryReport _report = MemoryReport();
+        std::unordered_map<const std::string*, std::size_t> _owners; // shared string -> first locale referencing it
+        const CatalogKeys* _keys = nullptr;                           // key list the key footprints are indexed by
+        std::unordered_map<std::string, std::size_t> _keyIndexes;     // key footprints of other key lists, by name
+
+    private:
+        /**
+         * @brief Get the footprint of a key: by index for the first key list met, by name for the others.
+         */
+        KeyFootprint& keyOf(const CatalogKeys& keys, std::size_t key) {
+            if (!_keys) {
+                _keys = &keys;
+                for (std::size_t i = 0; i < keys.size(); ++i) {
+                    KeyFootprint footprint = {keys.name(i), 0, 0};
+                    _report.keys.push_back(footprint);
+                    _keyIndexes.insert(std::make_pair(keys.name(i), i));
+                }
+            }
+            if (&keys == _keys)
+                return _report.keys[key];
+
+            std::pair<std::unordered_map<std::string, std::size_t>::iterator, bool> index
+                = _keyIndexes.insert(std::make_pair(keys.name(key), _report.keys.size()));
+            if (index.second) {
+                KeyFootprint footprint = {keys.name(key), 0, 0};
+                _report.keys.push_back(footprint);
+            }
+            return _report.keys[index.first->second];
+        }
+
+        /**
+         * @brief Bytes of the catalog object and of its slot tables.
+         */
+        static std::size_t tableBytes(const Catalog& catalog) {
+            return sizeof(Catalog) + catalog.size() * 2 * sizeof(std::shared_ptr<const void>) + (catalog.size() + 7) / 8;
+        }
+
+        /**
+         * @brief Bytes of a stored string and of its metadata, reference counting included.
+         */
+        static std::size_t entryBytes(const std::string& value, const TextMetrics* metrics) {
+            const char* object = reinterpret_cast<const char*>(&value);
+            bool embedded = value.data() >= object && value.data() < object + sizeof(std::string);
+            std::size_t bytes = sizeof(std::string) + CONTROL_BLOCK_BYTES + (embedded ? 0 : value.capacity() + 1);
+
+            if (metrics)
+                bytes += metrics->memoryBytes() + CONTROL_BLOCK_BYTES;
+            return bytes;
+        }
+
+};
@@ -0,0 +1,676 @@
+/**
+ * @file MoFile.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <fstream>
+#include <iterator>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+/**
+ * @brief Plural-Forms expression of a gettext catalog, e.g. `n != 1`.
+ *
+ * Compiled once into a tree of nodes, evaluated without allocation. Supports
+ * the C subset gettext accepts: `n`, unsigned integers, `?:`, `||`, `&&`,
+ * `==`, `!=`, `<`, `<=`, `>`, `>=`, `+`, `-`, `*`, `/`, `%`, `!` and
+ * parentheses. Division by zero evaluates to 0. Expressions nesting deeper
+ * than MAX_DEPTH or whose tree is taller than MAX_HEIGHT (a long `n+n+...`
+ * chain) are rejected, so evaluation recursion stays bounded.
+ *
+ * Example usage:
+ * @code
+ * PluralExpression polish;
+ * polish.parse("n==1 ? 0 : n%10>=2 && n%10<=4 && (n%100<10 || n%100>=20) ? 1 : 2");
+ * polish.evaluate(22); // 1
+ * @endcode
+ */
+class PluralExpression {
+
+    public:
+
+        /**
+         * @brief Build the expression `n != 1`, the gettext default.
+         */
+        PluralExpression() {
+            parse("n != 1");
+        }
+
+        /**
+         * @brief Compile an expression, the current one is kept on error.
+         *
+         * @param expression C expression of `n`.
+         * @return true if `expression` is well-formed and its tree is at most MAX_HEIGHT nodes deep.
+         */
+        bool parse(const std::string& expression) {
+            std::vector<Node> nodes;
+            std::size_t i = 0;
+            std::size_t root = parseTernary(expression, i, 0, nodes);
+
+            skipSpaces(expression, i);
+            if (root == INVALID || i != expression.size())
+                return false;
+            _nodes.swap(nodes);
+            _root = root;
+            return true;
+        }
+
+        /**
+         * @brief Evaluate the expression.
+         *
+         * @param n Count.
+         * @return unsigned long Plural form index, may exceed the number of forms if the expression is wrong.
+         */
+        unsigned long evaluate(unsigned long n) const {
+            return evaluate(_root, n);
+        }
+
+    private:
+        static const std::size_t INVALID = static_cast<std::size_t>(-1);
+        static const std::size_t MAX_DEPTH = 64;
+        static const std::size_t MAX_HEIGHT = 256;
+
+        struct Node {
+            char op;            // 'n', '0' (number), '?', '|', '&', '=', '!' (unary), 'x' (!=), '<', 'l' (<=), '>', 'g' (>=), '+', '-', '*', '/', '%'
+            unsigned long value;
+            std::size_t operands[3];
+            std::size_t height;  // longest path to a leaf, bounds the recursion of evaluate()
+        };
+
+    private:
+        std::vector<Node> _nodes;
+        std::size_t _root = 0;
+
+    private:
+        unsigned long evaluate(std::size_t index, unsigned long n) const {
+            const Node& node = _nodes[index];
+
+            switch (node.op) {
+                case 'n': return n;
+                case '0': return node.value;
+                case '!': return !evaluate(node.operands[0], n);
+                case '?': return evaluate(node.operands[0], n) ? evaluate(node.operands[1], n) : evaluate(node.operands[2], n);
+                case '|': return evaluate(node.operands[0], n) || evaluate(node.operands[1], n);
+                case '&': return evaluate(node.operands[0], n) && evaluate(node.operands[1], n);
+                default: break;
+            }
+
+            unsigned long left = evaluate(node.operands[0], n);
+            unsigned long right = evaluate(node.operands[1], n);
+            switch (node.op) {
+                case '=': return left == right;
+                case 'x': return left != right;
+                case '<': return left < right;
+                case 'l': return left <= right;
+                case '>': return left > right;
+                case 'g': return left >= right;
+                case '+': return left + right;
+                case '-': return left - right;
+                case '*': return left * right;
+                case '/': return right == 0 ? 0 : left / right;
+                case '%': return right == 0 ? 0 : left % right;
+                default: return 0;
+            }
+        }
+
+        static std::size_t add(std::vector<Node>& nodes, char op, unsigned long value, std::size_t first, std::size_t second, std::size_t third) {
+            Node node = {op, value, {first, second, third}, 1};
+
+            if (op != 'n' && op != '0' && (first == INVALID || (op != '!' && second == INVALID) || (op == '?' && third == INVALID)))
+                return INVALID;
+            for (std::size_t k = 0; k < 3; ++k)
+                if (node.operands[k] != INVALID)
+                    node.height = std::max(node.height, nodes[node.operands[k]].height + 1);
+            if (node.height > MAX_HEIGHT)
+                return INVALID;
+            nodes.push_back(node);
+            return nodes.size() - 1;
+        }
+
+        static std::size_t parseTernary(const std::string& e, std::size_t& i, std::size_t depth, std::vector<Node>& nodes) {
+            std::size_t condition = parseBinary(e, i, depth, 0, nodes);
+
+            skipSpaces(e, i);
+            if (condition == INVALID || i >= e.size() || e[i] != '?')
+                return condition;
+            ++i;
+            std::size_t yes = parseTernary(e, i, depth + 1, nodes);
+            skipSpaces(e, i);
+            if (yes == INVALID || i >= e.size() || e[i] != ':')
+                return INVALID;
+            ++i;
+            std::size_t no = parseTernary(e, i, depth + 1, nodes);
+            return add(nodes, '?', 0, condition, yes, no);
+        }
+
+        /**
+         * @brief Parse a left-associative chain of the operators of `level`, 0 (`||`) to 5 (`*`).
+         */
+        static std::size_t parseBinary(const std::string& e, std::size_t& i, std::size_t depth, int level, std::vector<Node>& nodes) {
+            if (level > 5)
+                return parseUnary(e, i, depth, nodes);
+
+            std::size_t left = parseBinary(e, i, depth, level + 1, nodes);
+            for (;;) {
+                skipSpaces(e, i);
+                char op = binaryOperator(e, i, level);
+                if (left == INVALID || op == 0)
+                    return left;
+                std::size_t right = parseBinary(e, i, depth, level + 1, nodes);
+                left = add(nodes, op, 0, left, right, INVALID);
+            }
+        }
+
+        /**
+         * @brief Consume the operator at `i` if it belongs to `level`.
+         *
+         * @return char Node op, 0 if none.
+         */
+        static char binaryOperator(const std::string& e, std::size_t& i, int level) {
+            char c = i < e.size() ? e[i] : '\0';
+            char next = i + 1 < e.size() ? e[i + 1] : '\0';
+
+            switch (level) {
+                case 0: if (c == '|' && next == '|') { i += 2; return '|'; } break;
+                case 1: if (c == '&' && next == '&') { i += 2; return '&'; } break;
+                case 2:
+                    if (c == '=' && next == '=') { i += 2; return '='; }
+                    if (c == '!' && next == '=') { i += 2; return 'x'; }
+                    break;
+                case 3:
+                    if ((c == '<' || c == '>') && next == '=') { i += 2; return c == '<' ? 'l' : 'g'; }
+                    if (c == '<' || c == '>') { ++i; return c; }
+                    break;
+                case 4: if (c == '+' || c == '-') { ++i; return c; } break;
+                case 5: if (c == '*' || c == '/' || c == '%') { ++i; return c; } break;
+                default: break;
+            }
+            return 0;
+        }
+
+        static std::size_t parseUnary(const std::string& e, std::size_t& i, std::size_t depth, std::vector<Node>& nodes) {
+            skipSpaces(e, i);
+            if (i >= e.size() || depth >= MAX_DEPTH)
+                return INVALID;
+            if (e[i] == '!') {
+                ++i;
+                return add(nodes, '!', 0, parseUnary(e, i, depth + 1, nodes), INVALID, INVALID);
+            }
+            if (e[i] == '(') {
+                ++i;
+                std::size_t inner = parseTernary(e, i, depth + 1, nodes);
+                skipSpaces(e, i);
+                if (inner == INVALID || i >= e.size() || e[i] != ')')
+                    return INVALID;
+                ++i;
+                return inner;
+            }
+            if (e[i] == 'n') {
+                ++i;
+                return add(nodes, 'n', 0, INVALID, INVALID, INVALID);
+            }
+            if (e[i] < '0' || e[i] > '9')
+                return INVALID;
+            unsigned long value = 0;
+            for (; i < e.size() && e[i] >= '0' && e[i] <= '9'; ++i)
+                value = value * 10 + static_cast<unsigned long>(e[i] - '0');
+            return add(nodes, '0', value, INVALID, INVALID, INVALID);
+        }
+
+        static void skipSpaces(const std::string& e, std::size_t& i) {
+            while (i < e.size() && (e[i] == ' ' || e[i] == '\t' || e[i] == '\n' || e[i] == '\r'))
+                ++i;
+        }
+
+};
+
+/**
+ * @brief GNU gettext `.mo` catalog, mapped in memory and read in place.
+ *
+ * open() maps the file and only checks its header and the bounds of its
+ * tables: there is no parsing pass, lookups use the hash table embedded by
+ * msgfmt (hashpjw, double hashing) and return pointers into the mapping.
+ * Files without hash table are searched by dichotomy on the sorted msgids.
+ * Both byte orders are read, whatever the host's.
+ *
+ * The language code and the plural rule come from the header entry (empty
+ * msgid): `Language:` and `Plural-Forms: nplurals=N; plural=EXPR;`. Plural
+ * entries hold "singular\0plural" as msgid and one translation per form.
+ * A msgctxt is written `context + "\x04" + msgid`, as gettext does.
+ *
+ * Example usage:
+ * @code
+ * std::shared_ptr<const MoFile> fr = MoFile::open("locale/fr/LC_MESSAGES/app.mo");
+ * std::size_t size = 0;
+ * const char* text = fr->find("Sign up", 7, size);              // "Inscription", in the mapping
+ * fr->text("file", "files", 3);                                  // "fichiers"
+ * @endcode
+ *
+ * @see MoLocale
+ */
+class MoFile {
+
+    public:
+
+        /**
+         * @brief Magic number of a `.mo` file, read in the file's byte order.
+         */
+        static const std::uint32_t MAGIC = 0x950412DEu;
+
+        /**
+         * @brief Map a `.mo` file.
+         *
+         * On platforms without mmap the file is read into memory instead.
+         *
+         * @param path Path of the file.
+         * @param languageCode Language code of the catalog, read from the `Language:` header if empty.
+         * @return std::shared_ptr<const MoFile> Catalog, nullptr if the file cannot be read, is not a valid `.mo` file or has a malformed `Plural-Forms:` rule.
+         */
+        static std::shared_ptr<const MoFile> open(const std::string& path, const std::string& languageCode = std::string()) {
+            std::shared_ptr<MoFile> file(new MoFile());
+
+            if (!file->map(path) || !file->readHeader())
+                return nullptr;
+            if (!file->readMetadata(languageCode))
+                return nullptr;
+            return file;
+        }
+
+        /**
+         * @brief Unmap the file.
+         */
+        ~MoFile() {
+#if defined(__unix__) || defined(__APPLE__)
+            if (_mapping)
+                munmap(_mapping, _size);
+#endif
+        }
+
+        /**
+         * @brief delete Copy constructor
+         */
+        MoFile(const MoFile&) = delete;
+
+        /**
+         * @brief delete Copy assignment
+         */
+        MoFile& operator=(const MoFile&) = delete;
+
+        /**
+         * @brief Get the language code of the catalog.
+         *
+         * @return const std::string& Language code, empty if unknown.
+         */
+        const std::string& languageCode() const {
+            return _code;
+        }
+
+        /**
+         * @brief Get the number of entries, header included.
+         *
+         * @return std::size_t Entry count.
+         */
+        std::size_t size() const {
+            return _count;
+        }
+
+        /**
+         * @brief Get the size of the file.
+         *
+         * @return std::size_t Bytes mapped, or read in memory if mapped() is false.
+         */
+        std::size_t fileSize() const {
+            return _size;
+        }
+
+        /**
+         * @brief Check whether the file is memory-mapped.
+         *
+         * @return true if mapped, false if read in memory (platforms without mmap).
+         */
+        bool mapped() const {
+            return _mapping != nullptr;
+        }
+
+        /**
+         * @brief Get the number of plural forms of the language.
+         *
+         * @return std::size_t `nplurals` of the header, 2 if absent.
+         */
+        std::size_t pluralCount() const {
+            return _pluralCount;
+        }
+
+        /**
+         * @brief Get the plural form used for a count.
+         *
+         * @param n Count.
+         * @return std::size_t Form index, lower than pluralCount().
+         */
+        std::size_t pluralIndex(unsigned long n) const {
+            unsigned long index = _plural.evaluate(n);
+
+            return index < _pluralCount ? static_cast<std::size_t>(index) : 0;
+        }
+
+        /**
+         * @brief Look up the translation of a msgid, in the mapping.
+         *
+         * @param msgid Msgid, singular form for plural entries, not null-terminated.
+         * @param msgidSize Length of the msgid.
+         * @param size Set to the length of the translation.
+         * @return const char* Null-terminated translation (first form for plural entries), nullptr if missing.
+         */
+        const char* find(const char* msgid, std::size_t msgidSize, std::size_t& size) const {
+            std::size_t entry = lookup(msgid, msgidSize);
+
+            return entry == NOT_FOUND ? nullptr : translation(entry, 0, size);
+        }
+
+        /**
+         * @brief Look up the plural form of a msgid for a count, in the mapping.
+         *
+         * @param msgid Singular msgid, not null-terminated.
+         * @param msgidSize Length of the msgid.
+         * @param n Count selecting the form through the Plural-Forms expression.
+         * @param size Set to the length of the translation.
+         * @return const char* Null-terminated translation, nullptr if missing.
+         */
+        const char* find(const char* msgid, std::size_t msgidSize, unsigned long n, std::size_t& size) const {
+            std::size_t entry = lookup(msgid, msgidSize);
+
+            return entry == NOT_FOUND ? nullptr : translation(entry, pluralIndex(n), size);
+        }
+
+        /**
+         * @brief Get a copy of the translation of a msgid, as gettext() does.
+         *
+         * @param msgid Msgid.
+         * @return std::string Translation, `msgid` itself if missing.
+         */
+        std::string text(const std::string& msgid) const {
+            std::size_t size = 0;
+            const char* text = find(msgid.data(), msgid.size(), size);
+
+            return text ? std::string(text, size) : msgid;
+        }
+
+        /**
+         * @brief Get a copy of the plural form of a msgid, as ngettext() does.
+         *
+         * @param msgid Singular msgid.
+         * @param msgidPlural Plural msgid, returned if missing and `n` is not 1.
+         * @param n Count.
+         * @return std::string Translation.
+         */
+        std::string text(const std::string& msgid, const std::string& msgidPlural, unsigned long n) const {
+            std::size_t size = 0;
+            const char* text = find(msgid.data(), msgid.size(), n, size);
+
+            if (text)
+                return std::string(text, size);
+            return n == 1 ? msgid : msgidPlural;
+        }
+
+        /**
+         * @brief Hash function of the msgfmt hash table (hashpjw).
+         *
+         * @param text Msgid.
+         * @param size Length of the msgid.
+         * @return std::uint32_t Hash value.
+         */
+        static std::uint32_t hash(const char* text, std::size_t size) {
+            std::uint32_t value = 0;
+
+            for (std::size_t i = 0; i < size; ++i) {
+                value = (value << 4) + static_cast<unsigned char>(text[i]);
+                std::uint32_t high = value & 0xF0000000u;
+                if (high)
+                    value ^= (high >> 24) ^ high;
+            }
+            return value;
+        }
+
+    private:
+        static const std::size_t HEADER_SIZE = 28;
+        static const std::size_t NOT_FOUND = static_cast<std::size_t>(-1);
+
+    private:
+        void* _mapping = nullptr;
+        std::string _buffer;            // file content where mmap is unavailable
+        const char* _data = nullptr;
+        std::size_t _size = 0;
+        bool _swap = false;
+        std::uint32_t _count = 0;
+        std::uint32_t _originals = 0;
+        std::uint32_t _translations = 0;
+        std::uint32_t _hashSize = 0;
+        std::uint32_t _hashOffset = 0;
+        std::string _code;
+        std::size_t _pluralCount = 2;
+        PluralExpression _plural;
+
+    private:
+        MoFile() {}
+
+        bool map(const std::string& path) {
+#if defined(__unix__) || defined(__APPLE__)
+            int fd = ::open(path.c_str(), O_RDONLY);
+            struct stat status;
+
+            if (fd < 0)
+                return false;
+            if (fstat(fd, &status) != 0 || status.st_size <= 0) {
+                ::close(fd);
+                return false;
+            }
+            _size = static_cast<std::size_t>(status.st_size);
+            void* mapping = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (mapping == MAP_FAILED)
+                return false;
+            _mapping = mapping;
+            _data = static_cast<const char*>(mapping);
+#else
+            std::ifstream in(path.c_str(), std::ios::binary);
+
+            if (!in)
+                return false;
+            _buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+            _data = _buffer.data();
+            _size = _buffer.size();
+#endif
+            return true;
+        }
+
+        /**
+         * @brief Check the magic number, the revision and the bounds of the tables.
+         */
+        bool readHeader() {
+            if (_size < HEADER_SIZE)
+                return false;
+            std::uint32_t magic = read32(0);
+            if (magic != MAGIC) {
+                _swap = true;
+                if (read32(0) != MAGIC)
+                    return false;
+            }
+            if ((read32(4) >> 16) > 1)
+                return false;
+            _count = read32(8);
+            _originals = read32(12);
+            _translations = read32(16);
+            _hashSize = read32(20);
+            _hashOffset = read32(24);
+            if (_hashSize < 3)
+                _hashSize = 0;
+            return fits(_originals, static_cast<std::uint64_t>(_count) * 8) && fits(_translations, static_cast<std::uint64_t>(_count) * 8)
+                && fits(_hashOffset, static_cast<std::uint64_t>(_hashSize) * 4) && _originals % 4 == 0 && _translations % 4 == 0;
+        }
+
+        /**
+         * @brief Read the language code and the plural rule from the header entry.
+         *
+         * @return false if the `plural=` expression is malformed or too deep to evaluate.
+         */
+        bool readMetadata(const std::string& languageCode) {
+            std::size_t size = 0;
+            const char* header = find("", 0, size);
+            std::string text = header ? std::string(header, size) : std::string();
+
+            _code = languageCode.empty() ? field(text, "Language:") : languageCode;
+            std::string forms = field(text, "Plural-Forms:");
+            std::size_t count = forms.find("nplurals=");
+            std::size_t plural = forms.find("plural=", count == std::string::npos ? 0 : count + 9);
+            if (count == std::string::npos || plural == std::string::npos)
+                return true;
+
+            unsigned long pluralCount = std::strtoul(forms.c_str() + count + 9, nullptr, 10);
+            std::string expression = forms.substr(plural + 7, forms.find(';', plural) - plural - 7);
+            if (!_plural.parse(expression))
+                return false;
+            if (pluralCount > 0 && pluralCount < 256)
+                _pluralCount = static_cast<std::size_t>(pluralCount);
+            return true;
+        }
+
+        /**
+         * @brief Get the value of a `Name: value` line of the header, trimmed.
+         */
+        static std::string field(const std::string& header, const char* name) {
+            std::size_t start = 0;
+
+            for (;;) {
+                if (header.compare(start, std::strlen(name), name) == 0)
+                    break;
+                start = header.find('\n', start);
+                if (start == std::string::npos)
+                    return std::string();
+                ++start;
+            }
+            start += std::strlen(name);
+            std::size_t end = header.find('\n', start);
+            std::string value = header.substr(start, end == std::string::npos ? std::string::npos : end - start);
+            value.erase(0, value.find_first_not_of(" \t"));
+            value.erase(value.find_last_not_of(" \t\r") + 1);
+            return value;
+        }
+
+        /**
+         * @brief Find the entry index of a msgid: hash table probe, or dichotomy without table.
+         */
+        std::size_t lookup(const char* msgid, std::size_t msgidSize) const {
+            if (_hashSize == 0)
+                return search(msgid, msgidSize);
+
+            std::uint32_t value = hash(msgid, msgidSize);
+            std::uint32_t index = value % _hashSize;
+            std::uint32_t increment = 1 + value % (_hashSize - 2);
+
+            for (std::uint32_t probe = 0; probe < _hashSize; ++probe) {
+                std::uint32_t entry = read32(_hashOffset + static_cast<std::size_t>(index) * 4);
+                if (entry == 0)
+                    return NOT_FOUND;
+                if (entry <= _count && compare(entry - 1, msgid, msgidSize) == 0)
+                    return entry - 1;
+                index = index >= _hashSize - increment ? index - (_hashSize - increment) : index + increment;
+            }
+            return NOT_FOUND;
+        }
+
+        std::size_t search(const char* msgid, std::size_t msgidSize) const {
+            std::size_t low = 0;
+            std::size_t high = _count;
+
+            while (low < high) {
+                std::size_t middle = low + (high - low) / 2;
+                int order = compare(middle, msgid, msgidSize);
+                if (order == 0)
+                    return middle;
+                if (order < 0)
+                    low = middle + 1;
+                else
+                    high = middle;
+            }
+            return NOT_FOUND;
+        }
+
+        /**
+         * @brief Get form `form` of the translation of an entry: forms are "form0\0form1\0...".
+         */
+        const char* translation(std::size_t entry, std::size_t form, std::size_t& size) const {
+            std::size_t length = 0;
+            const char* text = string(_translations, entry, length);
+
+            for (; text && form > 0; --form) {
+                std::size_t end = std::strlen(text) + 1;
+                if (end > length)
+                    return nullptr;
+                text += end;
+                length -= end;
+            }
+            if (text)
+                size = std::strlen(text);
+            return text;
+        }
+
+        /**
+         * @brief Compare the msgid of an entry (its singular part) with `msgid`, as strcmp() does.
+         */
+        int compare(std::size_t entry, const char* msgid, std::size_t msgidSize) const {
+            std::size_t length = 0;
+            const char* original = string(_originals, entry, length);
+
+            if (!original)
+                return 1;
+            std::size_t singular = std::strlen(original);
+            int order = std::memcmp(original, msgid, singular < msgidSize ? singular : msgidSize);
+            if (order != 0)
+                return order;
+            return singular < msgidSize ? -1 : singular > msgidSize ? 1 : 0;
+        }
+
+        /**
+         * @brief Get string `entry` of a descriptor table, nullptr if it lies outside the file or is not null-terminated.
+         */
+        const char* string(std::uint32_t table, std::size_t entry, std::size_t& length) const {
+            std::size_t descriptor = table + entry * 8;
+            length = read32(descriptor);
+            std::size_t offset = read32(descriptor + 4);
+
+            if (offset >= _size || length >= _size - offset || _data[offset + length] != '\0')
+                return nullptr;
+            return _data + offset;
+        }
+
+        bool fits(std::uint64_t offset, std::uint64_t size) const {
+            return offset <= _size && size <= _size - offset;
+        }
+
+        std::uint32_t read32(std::size_t offset) const {
+            std::uint32_t value;
+
+            std::memcpy(&value, _data + offset, 4);
+            if (_swap)
+                value = (value >> 24) | ((value >> 8) & 0xFF00u) | ((value << 8) & 0xFF0000u) | (value << 24);
+            return value;
+        }
+
+};
@@ -0,0 +1,106 @@
+/**
+ * @file MoLocale.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <memory>
+#include <cstring>
+#include <type_traits>
+
+#include "ILocale.hpp"
+#include "TypeTraits.hpp"
+#include "MoFile.hpp"
+
+/**
+ * @brief Locale implementation reading its strings from a gettext `.mo` file.
+ *
+ * Implements `languageCode()` from the file, the concrete locale only maps
+ * each getter of the interface to a msgid. Lookups go through the hash table
+ * of the mapped file; a missing msgid is returned untranslated, as gettext does.
+ *
+ * Example usage:
+ * @code
+ * class LocaleMo : public MoLocale<DefaultLocale> {
+ * public:
+ *     using MoLocale<DefaultLocale>::MoLocale;
+ *     const std::string getSignUpTitle() const override { return text("Sign up"); }
+ *     const std::string getSignInTitle() const override { return text("Sign in"); }
+ * };
+ *
+ * context.setSupportedMoFile<LocaleMo>("locale/fr/LC_MESSAGES/app.mo");
+ * @endcode
+ *
+ * @tparam T is the base locale interface derived from ILocale.
+ *
+ * @see I18nContext::setSupportedMoFile
+ */
+template<typename T, typename = typename std::enable_if<is_derived_from<T, ILocale>::value>::type>
+class MoLocale : public T {
+
+    public:
+
+        /**
+         * @brief Build the locale over a mapped file.
+         *
+         * @param file Catalog of the locale, shared and never modified.
+         */
+        explicit MoLocale(std::shared_ptr<const MoFile> file) : _file(file) {}
+
+        /**
+         * @brief Retrieve the language code of the file.
+         *
+         * @return std::string Language code.
+         */
+        const std::string languageCode() const override {
+            return _file->languageCode();
+        }
+
+        /**
+         * @brief Get the file backing the locale.
+         *
+         * @return const std::shared_ptr<const MoFile>& Mapped file.
+         */
+        const std::shared_ptr<const MoFile>& file() const {
+            return _file;
+        }
+
+    protected:
+        /**
+         * @brief Translate a msgid.
+         *
+         * @param msgid Null-terminated msgid.
+         * @return std::string Translation, `msgid` if missing.
+         */
+        std::string text(const char* msgid) const {
+            std::size_t size = 0;
+            const char* text = _file->find(msgid, std::strlen(msgid), size);
+
+            return text ? std::string(text, size) : std::string(msgid);
+        }
+
+        /**
+         * @brief Translate the plural form of a msgid for a count.
+         *
+         * @param msgid Null-terminated singular msgid.
+         * @param msgidPlural Null-terminated plural msgid.
+         * @param n Count.
+         * @return std::string Translation, `msgid` or `msgidPlural` if missing.
+         */
+        std::string text(const char* msgid, const char* msgidPlural, unsigned long n) const {
+            std::size_t size = 0;
+            const char* text = _file->find(msgid, std::strlen(msgid), n, size);
+
+            if (text)
+                return std::string(text, size);
+            return std::string(n == 1 ? msgid : msgidPlural);
+        }
+
+    private:
+        std::shared_ptr<const MoFile> _file;
+
+};
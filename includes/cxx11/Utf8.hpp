@@ -0,0 +1,697 @@
+/**
+ * @file Utf8.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    // GCC/Clang on x86: AVX2 and SSSE3 paths are compiled for their own target and selected at runtime.
+    #include <immintrin.h>
+    #define UTF8_RUNTIME_DISPATCH
+    #define UTF8_TARGET_AVX2 __attribute__((target("avx2")))
+    #define UTF8_TARGET_SSSE3 __attribute__((target("ssse3")))
+#elif defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__SSSE3__)
+    #include <tmmintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+#endif
+
+#if !defined(UTF8_RUNTIME_DISPATCH)
+    #define UTF8_TARGET_AVX2
+    #define UTF8_TARGET_SSSE3
+#endif
+
+#include "UnicodeData.hpp"
+
+/**
+ * @brief UTF-8 validation, decoding, transcoding to UTF-16/UTF-32 and NFC normalization.
+ *
+ * Validation uses the lookup algorithm of Keiser & Lemire ("Validating UTF-8
+ * in less than one instruction per byte") with AVX2 or SSSE3. With GCC/Clang on
+ * x86 the best one is selected at runtime from the CPU features; other
+ * compilers use the one enabled at compile time (-mavx2, -mssse3). The scalar
+ * fallback has an SSE2 ASCII fast path.
+ *
+ * Example usage:
+ * @code
+ * std::string text = "Cafe\xCC\x81"; // "Café" with a combining acute accent
+ * if (Utf8::validate(text))
+ *     text = Utf8::toNfc(text); // "Caf\xC3\xA9"
+ * @endcode
+ */
+class Utf8 {
+
+    public:
+
+        /**
+         * @brief Check whether a buffer is well-formed UTF-8.
+         *
+         * Rejects overlong forms, surrogates, code points above U+10FFFF and
+         * truncated sequences.
+         *
+         * @param data Bytes to check.
+         * @param size Number of bytes.
+         * @return true if the buffer is valid UTF-8.
+         */
+        static bool validate(const char* data, std::size_t size) {
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+            #if defined(UTF8_RUNTIME_DISPATCH)
+                static const int level = __builtin_cpu_supports("avx2") ? 2 : __builtin_cpu_supports("ssse3") ? 1 : 0;
+                if (level == 2)
+                    return validateAvx2(bytes, size);
+                if (level == 1)
+                    return validateSsse3(bytes, size);
+            #elif defined(__AVX2__)
+                return validateAvx2(bytes, size);
+            #elif defined(__SSSE3__)
+                return validateSsse3(bytes, size);
+            #endif
+            std::size_t i = asciiPrefix(bytes, size);
+            return validateScalar(bytes + i, size - i);
+        }
+
+        /**
+         * @brief Check whether a string is well-formed UTF-8.
+         *
+         * @param text String to check.
+         * @return true if the string is valid UTF-8.
+         */
+        static bool validate(const std::string& text) {
+            return validate(text.data(), text.size());
+        }
+
+        /**
+         * @brief Check whether a buffer only contains ASCII bytes.
+         *
+         * @param data Bytes to check.
+         * @param size Number of bytes.
+         * @return true if no byte has its high bit set.
+         */
+        static bool isAscii(const char* data, std::size_t size) {
+            return asciiPrefix(reinterpret_cast<const unsigned char*>(data), size) == size;
+        }
+
+        /**
+         * @brief Decode the code point starting at `index` and move past it.
+         *
+         * @param data Valid UTF-8 bytes.
+         * @param size Number of bytes.
+         * @param index Offset of a lead byte, advanced to the next code point.
+         * @return std::uint32_t Decoded code point.
+         */
+        static std::uint32_t decode(const char* data, std::size_t size, std::size_t& index) {
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+            std::uint32_t lead = bytes[index++];
+
+            if (lead < 0x80)
+                return lead;
+
+            std::size_t extra = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : 1;
+            std::uint32_t code = lead & (0x3F >> extra);
+            for (; extra > 0 && index < size; --extra)
+                code = (code << 6) | (bytes[index++] & 0x3F);
+            return code;
+        }
+
+        /**
+         * @brief Append the UTF-8 encoding of a code point.
+         *
+         * @param out Destination string.
+         * @param code Code point, at most U+10FFFF.
+         */
+        static void append(std::string& out, std::uint32_t code) {
+            if (code < 0x80) {
+                out += static_cast<char>(code);
+            } else if (code < 0x800) {
+                out += static_cast<char>(0xC0 | (code >> 6));
+                out += static_cast<char>(0x80 | (code & 0x3F));
+            } else if (code < 0x10000) {
+                out += static_cast<char>(0xE0 | (code >> 12));
+                out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (code & 0x3F));
+            } else {
+                out += static_cast<char>(0xF0 | (code >> 18));
+                out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+                out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (code & 0x3F));
+            }
+        }
+
+        /**
+         * @brief Encode a code point in UTF-8 into a raw buffer.
+         *
+         * @param code Code point, at most U+10FFFF.
+         * @param out Destination, room for 4 bytes.
+         * @return std::size_t Number of bytes written, 1 to 4.
+         */
+        static std::size_t encode(std::uint32_t code, char* out) {
+            if (code < 0x80) {
+                out[0] = static_cast<char>(code);
+                return 1;
+            }
+            if (code < 0x800) {
+                out[0] = static_cast<char>(0xC0 | (code >> 6));
+                out[1] = static_cast<char>(0x80 | (code & 0x3F));
+                return 2;
+            }
+            if (code < 0x10000) {
+                out[0] = static_cast<char>(0xE0 | (code >> 12));
+                out[1] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                out[2] = static_cast<char>(0x80 | (code & 0x3F));
+                return 3;
+            }
+            out[0] = static_cast<char>(0xF0 | (code >> 18));
+            out[1] = static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            out[2] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out[3] = static_cast<char>(0x80 | (code & 0x3F));
+            return 4;
+        }
+
+        /**
+         * @brief Transcode valid UTF-8 to UTF-16 into a raw buffer.
+         *
+         * Runs of ASCII are widened 16 bytes at a time when SSE2 is available.
+         *
+         * @param data Valid UTF-8 bytes.
+         * @param size Number of bytes.
+         * @param out Destination, room for `size` code units (UTF-16 never needs more).
+         * @return std::size_t Number of code units written.
+         */
+        static std::size_t toUtf16(const char* data, std::size_t size, char16_t* out) {
+            std::size_t written = 0;
+
+            for (std::size_t i = 0; i < size;) {
+                std::size_t ascii = widenAscii(reinterpret_cast<const unsigned char*>(data) + i, size - i, out + written);
+                i += ascii;
+                written += ascii;
+                if (i == size)
+                    break;
+
+                std::uint32_t code = decode(data, size, i);
+                if (code >= 0x10000) {
+                    code -= 0x10000;
+                    out[written++] = static_cast<char16_t>(0xD800 | (code >> 10));
+                    out[written++] = static_cast<char16_t>(0xDC00 | (code & 0x3FF));
+                } else {
+                    out[written++] = static_cast<char16_t>(code);
+                }
+            }
+            return written;
+        }
+
+        /**
+         * @brief Transcode valid UTF-8 to UTF-32 into a raw buffer.
+         *
+         * Runs of ASCII are widened 16 bytes at a time when SSE2 is available.
+         *
+         * @param data Valid UTF-8 bytes.
+         * @param size Number of bytes.
+         * @param out Destination, room for `size` code units (UTF-32 never needs more).
+         * @return std::size_t Number of code units written.
+         */
+        static std::size_t toUtf32(const char* data, std::size_t size, char32_t* out) {
+            std::size_t written = 0;
+
+            for (std::size_t i = 0; i < size;) {
+                std::size_t ascii = widenAscii(reinterpret_cast<const unsigned char*>(data) + i, size - i, out + written);
+                i += ascii;
+                written += ascii;
+                if (i == size)
+                    break;
+                out[written++] = decode(data, size, i);
+            }
+            return written;
+        }
+
+        /**
+         * @brief Transcode a valid UTF-8 string to UTF-16.
+         *
+         * @param text Valid UTF-8 string.
+         * @return std::u16string UTF-16 string.
+         */
+        static std::u16string toUtf16(const std::string& text) {
+            std::u16string out(text.size(), u'\0');
+
+            out.resize(toUtf16(text.data(), text.size(), &out[0]));
+            return out;
+        }
+
+        /**
+         * @brief Transcode a valid UTF-8 string to UTF-32.
+         *
+         * @param text Valid UTF-8 string.
+         * @return std::u32string UTF-32 string.
+         */
+        static std::u32string toUtf32(const std::string& text) {
+            std::u32string out(text.size(), U'\0');
+
+            out.resize(toUtf32(text.data(), text.size(), &out[0]));
+            return out;
+        }
+
+        /**
+         * @brief Quick check: true if the string is certainly in NFC.
+         *
+         * A false result only means toNfc() has to look at the string.
+         *
+         * @param text Valid UTF-8 string.
+         * @return true if the string needs no normalization.
+         */
+        static bool isNfc(const std::string& text) {
+            std::size_t i = asciiPrefix(reinterpret_cast<const unsigned char*>(text.data()), text.size());
+
+            while (i < text.size()) {
+                std::uint32_t code = decode(text.data(), text.size(), i);
+                if (UnicodeData::mayChangeInNfc(code))
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Decode a string into its canonical decomposition (NFD code points).
+         *
+         * @param text Valid UTF-8 string.
+         * @return std::vector<std::uint32_t> Decomposed and canonically ordered code points.
+         */
+        static std::vector<std::uint32_t> decompose(const std::string& text) {
+            std::vector<std::uint32_t> codes;
+
+            codes.reserve(text.size());
+            for (std::size_t i = 0; i < text.size();)
+                decomposeInto(codes, decode(text.data(), text.size(), i));
+            reorder(codes);
+            return codes;
+        }
+
+        /**
+         * @brief Normalize a string to Unicode Normalization Form C.
+         *
+         * Canonical decomposition, canonical ordering and canonical composition
+         * over the subset of UnicodeData (Latin, Greek, Cyrillic) plus Hangul.
+         * Code points outside this subset are left untouched.
+         *
+         * @param text Valid UTF-8 string.
+         * @return std::string NFC string.
+         */
+        static std::string toNfc(const std::string& text) {
+            if (isNfc(text))
+                return text;
+
+            std::vector<std::uint32_t> codes = decompose(text);
+            compose(codes);
+
+            std::string out;
+            out.reserve(text.size());
+            for (std::size_t i = 0; i < codes.size(); ++i)
+                append(out, codes[i]);
+            return out;
+        }
+
+    private:
+        static const std::uint32_t HANGUL_S_BASE = 0xAC00;
+        static const std::uint32_t HANGUL_L_BASE = 0x1100;
+        static const std::uint32_t HANGUL_V_BASE = 0x1161;
+        static const std::uint32_t HANGUL_T_BASE = 0x11A7;
+        static const std::uint32_t HANGUL_L_COUNT = 19;
+        static const std::uint32_t HANGUL_V_COUNT = 21;
+        static const std::uint32_t HANGUL_T_COUNT = 28;
+        static const std::uint32_t HANGUL_N_COUNT = HANGUL_V_COUNT * HANGUL_T_COUNT;
+        static const std::uint32_t HANGUL_S_COUNT = HANGUL_L_COUNT * HANGUL_N_COUNT;
+
+    private:
+        /**
+         * @brief Length of the leading run of ASCII bytes, 16 bytes at a time when SSE2 is available.
+         */
+        static std::size_t asciiPrefix(const unsigned char* bytes, std::size_t size) {
+            std::size_t i = 0;
+
+            #if defined(__SSE2__) || defined(_M_X64)
+                for (; i + 16 <= size; i += 16) {
+                    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+                    if (_mm_movemask_epi8(block) != 0)
+                        break;
+                }
+            #endif
+            while (i < size && bytes[i] < 0x80)
+                ++i;
+            return i;
+        }
+
+        /**
+         * @brief Copy the leading run of ASCII bytes into wider code units.
+         *
+         * @return std::size_t Length of the run.
+         */
+        template<typename T_Unit>
+        static std::size_t widenAscii(const unsigned char* bytes, std::size_t size, T_Unit* out) {
+            std::size_t i = 0;
+
+            #if defined(__SSE2__) || defined(_M_X64)
+                for (; i + 16 <= size; i += 16) {
+                    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+                    if (_mm_movemask_epi8(block) != 0)
+                        break;
+                    storeWidened(block, out + i);
+                }
+            #endif
+            for (; i < size && bytes[i] < 0x80; ++i)
+                out[i] = static_cast<T_Unit>(bytes[i]);
+            return i;
+        }
+
+        #if defined(__SSE2__) || defined(_M_X64)
+            /**
+             * @brief Zero-extend 16 ASCII bytes to 16 UTF-16 code units.
+             */
+            static void storeWidened(__m128i block, char16_t* out) {
+                __m128i zero = _mm_setzero_si128();
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(block, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpackhi_epi8(block, zero));
+            }
+
+            /**
+             * @brief Zero-extend 16 ASCII bytes to 16 UTF-32 code units.
+             */
+            static void storeWidened(__m128i block, char32_t* out) {
+                __m128i zero = _mm_setzero_si128();
+                __m128i low = _mm_unpacklo_epi8(block, zero);
+                __m128i high = _mm_unpackhi_epi8(block, zero);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4), _mm_unpackhi_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpacklo_epi16(high, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12), _mm_unpackhi_epi16(high, zero));
+            }
+        #endif
+
+        /**
+         * @brief Byte-by-byte validation (Unicode Table 3-7, well-formed byte sequences).
+         */
+        static bool validateScalar(const unsigned char* bytes, std::size_t size) {
+            std::size_t i = 0;
+
+            while (i < size) {
+                unsigned char lead = bytes[i];
+                if (lead < 0x80) {
+                    ++i;
+                    continue;
+                }
+
+                std::size_t length = 0;
+                unsigned char low = 0x80;
+                unsigned char high = 0xBF;
+                if (lead >= 0xC2 && lead <= 0xDF) {
+                    length = 2;
+                } else if (lead >= 0xE0 && lead <= 0xEF) {
+                    length = 3;
+                    if (lead == 0xE0) low = 0xA0;
+                    if (lead == 0xED) high = 0x9F;
+                } else if (lead >= 0xF0 && lead <= 0xF4) {
+                    length = 4;
+                    if (lead == 0xF0) low = 0x90;
+                    if (lead == 0xF4) high = 0x8F;
+                } else {
+                    return false;
+                }
+                if (size - i < length)
+                    return false;
+                if (bytes[i + 1] < low || bytes[i + 1] > high)
+                    return false;
+                for (std::size_t k = 2; k < length; ++k)
+                    if ((bytes[i + k] & 0xC0) != 0x80)
+                        return false;
+                i += length;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Error flags of the lookup algorithm, one bit per class of invalid byte pair.
+         */
+        enum LookupError {
+            TOO_SHORT = 1 << 0,         // 11______ 0_______ or 11______ 11______
+            TOO_LONG = 1 << 1,          // 0_______ 10______
+            OVERLONG_3 = 1 << 2,        // 11100000 100_____
+            TOO_LARGE = 1 << 3,         // 11110100 1001____, 11110100 101_____, 11110101+
+            SURROGATE = 1 << 4,         // 11101101 101_____
+            OVERLONG_2 = 1 << 5,        // 1100000_ 10______
+            TOO_LARGE_1000 = 1 << 6,    // 11110101+ 1000____
+            OVERLONG_4 = 1 << 6,        // 11110000 1000____
+            TWO_CONTS = 1 << 7,         // 10______ 10______
+            CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS
+        };
+
+        /**
+         * @brief Lookup tables indexed by a nibble: high nibble of byte 1, low nibble of byte 1, high nibble of byte 2.
+         */
+        static const unsigned char* lookupTable(int which) {
+            static const unsigned char tables[3][16] = {
+                {
+                    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+                    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+                    TOO_SHORT | OVERLONG_2,
+                    TOO_SHORT,
+                    TOO_SHORT | OVERLONG_3 | SURROGATE,
+                    TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+                },
+                {
+                    CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+                    CARRY | OVERLONG_2,
+                    CARRY,
+                    CARRY,
+                    CARRY | TOO_LARGE,
+                    CARRY | TOO_LARGE | TOO_LARGE_1000,
+                    CARRY | TOO_LARGE | TOO_LARGE_1000,
+                    CARRY | TOO_LARGE | TOO_LARGE_1000,
+                    CARRY | TOO_LARGE | TOO_LARGE_1000,
+                    CARRY | TOO_LARGE | TOO_LARGE_1000,
+                    CARRY | TOO_LARGE | TOO_LARGE_1000,
+                    CARRY | TOO_LARGE | TOO_LARGE_1000,
+                    CARRY | TOO_LARGE | TOO_LARGE_1000,
+                    CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+                    CARRY | TOO_LARGE | TOO_LARGE_1000,
+                    CARRY | TOO_LARGE | TOO_LARGE_1000
+                },
+                {
+                    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+                    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+                    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+                    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+                    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+                    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+                }
+            };
+
+            return tables[which];
+        }
+
+        #if defined(UTF8_RUNTIME_DISPATCH) || defined(__AVX2__)
+            /**
+             * @brief Validate 32 bytes at a time; a zero block is appended to catch truncated sequences.
+             */
+            UTF8_TARGET_AVX2 static bool validateAvx2(const unsigned char* bytes, std::size_t size) {
+                const __m256i high1 = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lookupTable(0))));
+                const __m256i low1 = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lookupTable(1))));
+                const __m256i high2 = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lookupTable(2))));
+                const __m256i nibble = _mm256_set1_epi8(0x0F);
+                const __m256i incompleteMax = _mm256_setr_epi8(
+                    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                    static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+                __m256i previous = _mm256_setzero_si256();
+                __m256i incomplete = _mm256_setzero_si256();
+                __m256i error = _mm256_setzero_si256();
+                unsigned char tail[32];
+                std::size_t i = 0;
+
+                for (bool last = false; !last; i += 32) {
+                    __m256i input;
+                    if (i + 32 <= size) {
+                        input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i));
+                    } else {
+                        std::memset(tail, 0, sizeof(tail));
+                        if (i < size)
+                            std::memcpy(tail, bytes + i, size - i);
+                        input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tail));
+                        last = true;
+                    }
+
+                    if (_mm256_movemask_epi8(input) == 0) {
+                        error = _mm256_or_si256(error, incomplete);
+                    } else {
+                        __m256i carried = _mm256_permute2x128_si256(previous, input, 0x21);
+                        __m256i prev1 = _mm256_alignr_epi8(input, carried, 16 - 1);
+                        __m256i prev2 = _mm256_alignr_epi8(input, carried, 16 - 2);
+                        __m256i prev3 = _mm256_alignr_epi8(input, carried, 16 - 3);
+                        __m256i special = _mm256_and_si256(
+                            _mm256_and_si256(
+                                _mm256_shuffle_epi8(high1, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+                                _mm256_shuffle_epi8(low1, _mm256_and_si256(prev1, nibble))),
+                            _mm256_shuffle_epi8(high2, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble)));
+                        __m256i mustContinue = _mm256_and_si256(
+                            _mm256_or_si256(
+                                _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80))),
+                                _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)))),
+                            _mm256_set1_epi8(static_cast<char>(0x80)));
+                        error = _mm256_or_si256(error, _mm256_xor_si256(mustContinue, special));
+                    }
+                    incomplete = _mm256_subs_epu8(input, incompleteMax);
+                    previous = input;
+                }
+                error = _mm256_or_si256(error, incomplete);
+                return _mm256_testz_si256(error, error) != 0;
+            }
+        #endif
+
+        #if defined(UTF8_RUNTIME_DISPATCH) || (defined(__SSSE3__) && !defined(__AVX2__))
+            /**
+             * @brief Validate 16 bytes at a time; a zero block is appended to catch truncated sequences.
+             */
+            UTF8_TARGET_SSSE3 static bool validateSsse3(const unsigned char* bytes, std::size_t size) {
+                const __m128i high1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lookupTable(0)));
+                const __m128i low1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lookupTable(1)));
+                const __m128i high2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lookupTable(2)));
+                const __m128i nibble = _mm_set1_epi8(0x0F);
+                const __m128i incompleteMax = _mm_setr_epi8(
+                    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                    static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+                __m128i previous = _mm_setzero_si128();
+                __m128i incomplete = _mm_setzero_si128();
+                __m128i error = _mm_setzero_si128();
+                unsigned char tail[16];
+                std::size_t i = 0;
+
+                for (bool last = false; !last; i += 16) {
+                    __m128i input;
+                    if (i + 16 <= size) {
+                        input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+                    } else {
+                        std::memset(tail, 0, sizeof(tail));
+                        if (i < size)
+                            std::memcpy(tail, bytes + i, size - i);
+                        input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tail));
+                        last = true;
+                    }
+
+                    if (_mm_movemask_epi8(input) == 0) {
+                        error = _mm_or_si128(error, incomplete);
+                    } else {
+                        __m128i prev1 = _mm_alignr_epi8(input, previous, 16 - 1);
+                        __m128i prev2 = _mm_alignr_epi8(input, previous, 16 - 2);
+                        __m128i prev3 = _mm_alignr_epi8(input, previous, 16 - 3);
+                        __m128i special = _mm_and_si128(
+                            _mm_and_si128(
+                                _mm_shuffle_epi8(high1, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+                                _mm_shuffle_epi8(low1, _mm_and_si128(prev1, nibble))),
+                            _mm_shuffle_epi8(high2, _mm_and_si128(_mm_srli_epi16(input, 4), nibble)));
+                        __m128i mustContinue = _mm_and_si128(
+                            _mm_or_si128(
+                                _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80))),
+                                _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)))),
+                            _mm_set1_epi8(static_cast<char>(0x80)));
+                        error = _mm_or_si128(error, _mm_xor_si128(mustContinue, special));
+                    }
+                    incomplete = _mm_subs_epu8(input, incompleteMax);
+                    previous = input;
+                }
+                error = _mm_or_si128(error, incomplete);
+                return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+            }
+        #endif
+
+        /**
+         * @brief Append the full canonical decomposition of a code point.
+         */
+        static void decomposeInto(std::vector<std::uint32_t>& out, std::uint32_t code) {
+            if (code >= HANGUL_S_BASE && code < HANGUL_S_BASE + HANGUL_S_COUNT) {
+                std::uint32_t index = code - HANGUL_S_BASE;
+                out.push_back(HANGUL_L_BASE + index / HANGUL_N_COUNT);
+                out.push_back(HANGUL_V_BASE + (index % HANGUL_N_COUNT) / HANGUL_T_COUNT);
+                if (index % HANGUL_T_COUNT != 0)
+                    out.push_back(HANGUL_T_BASE + index % HANGUL_T_COUNT);
+                return;
+            }
+
+            std::uint32_t first = 0;
+            std::uint32_t second = 0;
+            if (!UnicodeData::decompose(code, first, second)) {
+                out.push_back(code);
+                return;
+            }
+            decomposeInto(out, first);
+            if (second != 0)
+                decomposeInto(out, second);
+        }
+
+        /**
+         * @brief Canonical ordering: stable sort of each run of combining marks by combining class.
+         */
+        static void reorder(std::vector<std::uint32_t>& codes) {
+            for (std::size_t i = 1; i < codes.size(); ++i) {
+                std::uint8_t cc = UnicodeData::combiningClass(codes[i]);
+                if (cc == 0)
+                    continue;
+                for (std::size_t k = i; k > 0; --k) {
+                    std::uint8_t previous = UnicodeData::combiningClass(codes[k - 1]);
+                    if (previous <= cc)
+                        break;
+                    std::swap(codes[k - 1], codes[k]);
+                }
+            }
+        }
+
+        /**
+         * @brief Primary composite of a pair, Hangul included.
+         */
+        static std::uint32_t composePair(std::uint32_t first, std::uint32_t second) {
+            if (first >= HANGUL_L_BASE && first < HANGUL_L_BASE + HANGUL_L_COUNT
+                && second >= HANGUL_V_BASE && second < HANGUL_V_BASE + HANGUL_V_COUNT)
+                return HANGUL_S_BASE + ((first - HANGUL_L_BASE) * HANGUL_V_COUNT + (second - HANGUL_V_BASE)) * HANGUL_T_COUNT;
+            if (first >= HANGUL_S_BASE && first < HANGUL_S_BASE + HANGUL_S_COUNT && (first - HANGUL_S_BASE) % HANGUL_T_COUNT == 0
+                && second > HANGUL_T_BASE && second < HANGUL_T_BASE + HANGUL_T_COUNT)
+                return first + (second - HANGUL_T_BASE);
+            return UnicodeData::compose(first, second);
+        }
+
+        /**
+         * @brief Canonical composition (UAX #15), in place.
+         */
+        static void compose(std::vector<std::uint32_t>& codes) {
+            if (codes.empty())
+                return;
+
+            std::size_t starter = 0;
+            int lastClass = UnicodeData::combiningClass(codes[0]) == 0 ? 0 : 256;
+            std::size_t out = 1;
+
+            for (std::size_t i = 1; i < codes.size(); ++i) {
+                std::uint32_t code = codes[i];
+                int cc = UnicodeData::combiningClass(code);
+                std::uint32_t composite = composePair(codes[starter], code);
+
+                if (composite != 0 && (lastClass < cc || lastClass == 0)) {
+                    codes[starter] = composite;
+                    continue;
+                }
+                if (cc == 0)
+                    starter = out;
+                lastClass = cc;
+                codes[out++] = code;
+            }
+            codes.resize(out);
+        }
+
+};
@@ -0,0 +1,245 @@
+/**
+ * @file CatalogExporter.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <ostream>
+#include <cstddef>
+#include <cstdint>
+
+#include "Catalog.hpp"
+#include "Binary.hpp"
+
+/**
+ * @brief Output format of CatalogExporter::write().
+ */
+enum class ExportFormat {
+    Json,       ///< One JSON object, key names to strings.
+    Binary      ///< Length-prefixed entries behind a small header.
+};
+
+/**
+ * @brief Streams the strings of a Catalog, or of a subset of its keys, for client bundles.
+ *
+ * The output is written piece by piece to a std::ostream, straight from the
+ * catalog storage: no intermediate document is built. Two formats:
+ * - Json: `{"signUpTitle":"Inscription","signInTitle":"Connexion"}`, keys in index order.
+ * - Binary: "I18N", version byte, 64-bit content hash (little-endian), then
+ *   the language code, the entry count and each name and value, every length
+ *   as an unsigned LEB128 varint.
+ *
+ * Missing keys are left out. The content hash (FNV-1a 64 over the language
+ * code and the exported names and values) only depends on the content, not on
+ * the format: a server can use etag() to answer "304 Not Modified" without
+ * serializing again.
+ *
+ * Example usage:
+ * @code
+ * CatalogExporter exporter(context.getCatalog("fr"), {"signInTitle", "buttonSubmit"});
+ * if (request.ifNoneMatch() == exporter.etag())
+ *     return notModified();
+ * exporter.write(response.body(), ExportFormat::Json);
+ * @endcode
+ */
+class CatalogExporter {
+
+    public:
+
+        /**
+         * @brief Version byte written after the magic of the binary format.
+         */
+        static constexpr unsigned char BINARY_VERSION = 1;
+
+        /**
+         * @brief Export every key of a catalog.
+         *
+         * @param catalog Catalog to export, must not be null.
+         */
+        explicit CatalogExporter(std::shared_ptr<const Catalog> catalog) : _catalog(catalog), _keys(catalog->size()) {
+            for (std::size_t key = 0; key < _keys.size(); ++key)
+                _keys[key] = key;
+            _hash = computeHash();
+        }
+
+        /**
+         * @brief Export a subset of the keys of a catalog.
+         *
+         * @param catalog Catalog to export, must not be null.
+         * @param names Key names, in output order. Unknown names are ignored.
+         */
+        CatalogExporter(std::shared_ptr<const Catalog> catalog, const std::vector<std::string>& names) : _catalog(catalog) {
+            _keys.reserve(names.size());
+            for (const auto& name : names) {
+                auto key = catalog->keys().index(name);
+                if (key != CatalogKeys::npos)
+                    _keys.push_back(key);
+            }
+            _hash = computeHash();
+        }
+
+        /**
+         * @brief Get the exported key indexes.
+         *
+         * @return const std::vector<std::size_t>& Key indexes, in output order.
+         */
+        const std::vector<std::size_t>& keys() const {
+            return _keys;
+        }
+
+        /**
+         * @brief Get the content hash of the export.
+         *
+         * @return std::uint64_t FNV-1a 64 hash, the same for the same code, keys and strings.
+         */
+        std::uint64_t hash() const {
+            return _hash;
+        }
+
+        /**
+         * @brief Get the content hash as an HTTP entity tag.
+         *
+         * @return std::string Quoted hexadecimal hash (e.g. "\"9ae16a3b2f90404f\"").
+         */
+        std::string etag() const {
+            constexpr char digits[] = "0123456789abcdef";
+            std::string tag(18, '"');
+
+            for (std::size_t i = 0; i < 16; ++i)
+                tag[16 - i] = digits[(_hash >> (4 * i)) & 0xF];
+            return tag;
+        }
+
+        /**
+         * @brief Stream the export.
+         *
+         * @param out Destination stream, opened in binary mode for ExportFormat::Binary.
+         * @param format Json or Binary.
+         */
+        void write(std::ostream& out, ExportFormat format) const {
+            if (format == ExportFormat::Binary)
+                writeBinary(out);
+            else
+                writeJson(out);
+        }
+
+        /**
+         * @brief Compute the content hash of a set of keys without building an exporter.
+         *
+         * @param catalog Catalog to hash.
+         * @param keys Key indexes, in export order.
+         * @return std::uint64_t FNV-1a 64 hash, as returned by hash().
+         */
+        static std::uint64_t contentHash(const Catalog& catalog, const std::vector<std::size_t>& keys) {
+            std::uint64_t hash = Binary::FNV_OFFSET_BASIS;
+
+            hashString(hash, catalog.languageCode());
+            for (std::size_t i = 0; i < keys.size(); ++i) {
+                const auto* value = catalog.find(keys[i]);
+                if (!value)
+                    continue;
+                hashString(hash, catalog.keys().name(keys[i]));
+                hashString(hash, *value);
+            }
+            return hash;
+        }
+
+    private:
+        std::shared_ptr<const Catalog> _catalog;
+        std::vector<std::size_t> _keys;
+        std::uint64_t _hash;
+
+    private:
+        std::uint64_t computeHash() const {
+            return contentHash(*_catalog, _keys);
+        }
+
+        /**
+         * @brief Hash the length of a string (8 bytes, little-endian) then its bytes.
+         */
+        static void hashString(std::uint64_t& hash, const std::string& text) {
+            std::uint64_t size = text.size();
+
+            for (std::size_t i = 0; i < 8; ++i)
+                hash = Binary::fnv1a(hash, (size >> (8 * i)) & 0xFF);
+            hash = Binary::fnv1a(hash, text.data(), text.size());
+        }
+
+        void writeJson(std::ostream& out) const {
+            bool first = true;
+
+            out.put('{');
+            for (std::size_t i = 0; i < _keys.size(); ++i) {
+                const auto* value = _catalog->find(_keys[i]);
+                if (!value)
+                    continue;
+                if (!first)
+                    out.put(',');
+                first = false;
+                writeJsonString(out, _catalog->keys().name(_keys[i]));
+                out.put(':');
+                writeJsonString(out, *value);
+            }
+            out.put('}');
+        }
+
+        /**
+         * @brief Write a quoted JSON string, copying the runs that need no escape as is.
+         */
+        static void writeJsonString(std::ostream& out, const std::string& text) {
+            constexpr char digits[] = "0123456789abcdef";
+            std::size_t start = 0;
+
+            out.put('"');
+            for (std::size_t i = 0; i < text.size(); ++i) {
+                unsigned char byte = static_cast<unsigned char>(text[i]);
+                if (byte >= 0x20 && byte != '"' && byte != '\\')
+                    continue;
+                out.write(text.data() + start, static_cast<std::streamsize>(i - start));
+                start = i + 1;
+                out.put('\\');
+                switch (byte) {
+                    case '"': out.put('"'); break;
+                    case '\\': out.put('\\'); break;
+                    case '\n': out.put('n'); break;
+                    case '\r': out.put('r'); break;
+                    case '\t': out.put('t'); break;
+                    default:
+                        out.write("u00", 3);
+                        out.put(digits[byte >> 4]);
+                        out.put(digits[byte & 0xF]);
+                }
+            }
+            out.write(text.data() + start, static_cast<std::streamsize>(text.size() - start));
+            out.put('"');
+        }
+
+        void writeBinary(std::ostream& out) const {
+            std::size_t count = 0;
+
+            for (std::size_t i = 0; i < _keys.size(); ++i)
+                if (_catalog->find(_keys[i]))
+                    ++count;
+
+            out.write("I18N", 4);
+            out.put(static_cast<char>(BINARY_VERSION));
+            for (std::size_t i = 0; i < 8; ++i)
+                out.put(static_cast<char>((_hash >> (8 * i)) & 0xFF));
+            Binary::writeString(out, _catalog->languageCode());
+            Binary::writeVarint(out, count);
+            for (std::size_t i = 0; i < _keys.size(); ++i) {
+                const auto* value = _catalog->find(_keys[i]);
+                if (!value)
+                    continue;
+                Binary::writeString(out, _catalog->keys().name(_keys[i]));
+                Binary::writeString(out, *value);
+            }
+        }
+
+};
@@ -0,0 +1,411 @@
+/**
+ * @file Collator.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "Utf8.hpp"
+#include "UnicodeData.hpp"
+
+/**
+ * @brief Locale-aware string ordering through binary sort keys.
+ *
+ * Weights follow the Unicode Collation Algorithm on a subset of the DUCET:
+ * punctuation, digits, Latin, Greek and Cyrillic letters have explicit
+ * weights, diacritics are secondary differences and case is a tertiary
+ * difference. Other code points get implicit weights in code point order.
+ * Per-language tailorings reorder letters of the alphabet (Spanish "ñ",
+ * Swedish "å ä ö", Czech "ch", ...).
+ *
+ * A sort key is computed once per string, then comparing two strings is a
+ * plain byte comparison (memcmp, std::string::compare).
+ *
+ * Example usage:
+ * @code
+ * const Collator& collator = Collator::forLanguage("sv");
+ * std::string a = collator.sortKey("\xC3\xA4pple"); // "äpple"
+ * std::string z = collator.sortKey("zebra");
+ * z < a; // true: in Swedish "ä" sorts after "z"
+ * @endcode
+ */
+class Collator {
+
+    public:
+
+        /**
+         * @brief Get the shared collator of a language, built on first use.
+         *
+         * @param code Language code, a region suffix ("fr-CA", "sv_SE") is ignored.
+         * @return const Collator& Collator, root order if the language has no tailoring.
+         */
+        static const Collator& forLanguage(const std::string& code) {
+            static std::mutex mutex;
+            static std::map<std::string, std::unique_ptr<Collator>> collators;
+            std::string language = code.substr(0, code.find_first_of("-_"));
+
+            std::lock_guard lock(mutex);
+            auto& collator = collators[language];
+            if (!collator)
+                collator = std::make_unique<Collator>(language);
+            return *collator;
+        }
+
+        /**
+         * @brief Build the collator of a language.
+         *
+         * @param code Language code (e.g., "es"), empty for the root order.
+         */
+        explicit Collator(const std::string& code = std::string()) : _code(code) {
+            std::size_t count = 0;
+            const Rule* rules = tailoringRules(count);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                if (!matchesLanguage(rules[i].languages, code))
+                    continue;
+                std::uint16_t primary = static_cast<std::uint16_t>(letterPrimary(rules[i].after) + rules[i].rank);
+                addTailoring(rules[i].lower, primary, TERTIARY_LOWER);
+                addTailoring(rules[i].upper, primary, TERTIARY_UPPER);
+            }
+            std::ranges::stable_sort(_tailorings, [](const Tailoring& a, const Tailoring& b) {
+                return a.sequence.size() > b.sequence.size();
+            });
+            for (const auto& tailoring : _tailorings)
+                _firsts.push_back(tailoring.sequence[0]);
+            std::ranges::sort(_firsts);
+        }
+
+        /**
+         * @brief Get the language of the collator.
+         *
+         * @return const std::string& Language code, empty for the root order.
+         */
+        const std::string& languageCode() const {
+            return _code;
+        }
+
+        /**
+         * @brief Compute the sort key of a string.
+         *
+         * @param text Valid UTF-8 string.
+         * @return std::string Binary key, compare keys bytewise.
+         */
+        std::string sortKey(const std::string& text) const {
+            std::string key;
+
+            appendSortKey(text, key);
+            return key;
+        }
+
+        /**
+         * @brief Append the sort key of a string to a buffer.
+         *
+         * Layout: 16-bit primary weights, 0x0000, secondary weights, 0x00,
+         * tertiary weights. No weight is zero, so a shorter string sorts first.
+         *
+         * @param text Valid UTF-8 string.
+         * @param key Destination buffer.
+         */
+        void appendSortKey(const std::string& text, std::string& key) const {
+            std::vector<std::uint32_t> codes;
+            if (Utf8::isAscii(text.data(), text.size()))
+                codes.assign(text.begin(), text.end());
+            else
+                codes = Utf8::decompose(text);
+
+            std::string secondary;
+            std::string tertiary;
+            key.reserve(key.size() + codes.size() * 2 + 3);
+            secondary.reserve(codes.size());
+            tertiary.reserve(codes.size());
+            for (std::size_t i = 0; i < codes.size();) {
+                std::size_t length = matchTailoring(codes, i, key, secondary, tertiary);
+                if (length == 0)
+                    length = appendElements(codes[i], key, secondary, tertiary);
+                i += length;
+            }
+            key += '\0';
+            key += '\0';
+            key += secondary;
+            key += '\0';
+            key += tertiary;
+        }
+
+        /**
+         * @brief Compare two strings.
+         *
+         * Prefer sortKey() when the same string is compared many times.
+         *
+         * @return int Negative, zero or positive like std::string::compare.
+         */
+        int compare(const std::string& a, const std::string& b) const {
+            return sortKey(a).compare(sortKey(b));
+        }
+
+        /**
+         * @brief Sort strings in the order of the collator, keys computed once per string.
+         *
+         * @param values Strings to sort in place.
+         */
+        void sort(std::vector<std::string>& values) const {
+            std::vector<std::pair<std::string, std::size_t>> keys(values.size());
+
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                keys[i].first = sortKey(values[i]);
+                keys[i].second = i;
+            }
+            std::ranges::sort(keys);
+
+            std::vector<std::string> sorted;
+            sorted.reserve(values.size());
+            for (const auto& [key, index] : keys)
+                sorted.push_back(std::move(values[index]));
+            values.swap(sorted);
+        }
+
+    private:
+        static constexpr std::uint16_t PRIMARY_PUNCTUATION = 0x0200;
+        static constexpr std::uint16_t PRIMARY_DIGIT = 0x0800;
+        static constexpr std::uint16_t PRIMARY_LETTER = 0x1000;
+        static constexpr std::uint16_t PRIMARY_GREEK = 0x2000;
+        static constexpr std::uint16_t PRIMARY_CYRILLIC = 0x3000;
+        static constexpr std::uint16_t PRIMARY_IMPLICIT = 0xFB40;
+
+        enum Weight {
+            SECONDARY_BASE = 0x05,
+            SECONDARY_STROKE = 0x30,
+            TERTIARY_LOWER = 0x05,
+            TERTIARY_VARIANT = 0x06,
+            TERTIARY_UPPER = 0x0A
+        };
+
+        /**
+         * @brief Tailoring of a language: a letter sorted right after `after` (or equal to it with rank 0).
+         */
+        struct Rule {
+            const char* languages;      // space separated language codes
+            char after;                 // Latin letter the tailored letter follows
+            std::uint8_t rank;          // position after `after`, 1 for the first
+            std::uint32_t lower[3];     // NFD sequence, lowercase, zero terminated
+            std::uint32_t upper[3];     // NFD sequence, uppercase, zero terminated
+        };
+
+        struct Tailoring {
+            std::vector<std::uint32_t> sequence;
+            std::uint16_t primary;
+            char tertiary;
+        };
+
+    private:
+        std::string _code;
+        std::vector<Tailoring> _tailorings; // longest sequence first
+        std::vector<std::uint32_t> _firsts; // sorted first code points of _tailorings
+
+    private:
+        static const Rule* tailoringRules(std::size_t& count) {
+            static constexpr Rule rules[] = {
+                {"es", 'n', 1, {'n', 0x0303}, {'N', 0x0303}},
+                {"sv fi", 'z', 1, {'a', 0x030A}, {'A', 0x030A}},
+                {"sv fi", 'z', 2, {'a', 0x0308}, {'A', 0x0308}},
+                {"sv fi", 'z', 3, {'o', 0x0308}, {'O', 0x0308}},
+                {"da nb nn no", 'z', 1, {0x00E6}, {0x00C6}},
+                {"da nb nn no", 'z', 2, {0x00F8}, {0x00D8}},
+                {"da nb nn no", 'z', 3, {'a', 0x030A}, {'A', 0x030A}},
+                {"tr az", 'c', 1, {'c', 0x0327}, {'C', 0x0327}},
+                {"tr az", 'g', 1, {'g', 0x0306}, {'G', 0x0306}},
+                {"tr az", 'h', 1, {0x0131}, {'I'}},
+                {"tr az", 'i', 0, {'i'}, {'I', 0x0307}},
+                {"tr az", 'o', 1, {'o', 0x0308}, {'O', 0x0308}},
+                {"tr az", 's', 1, {'s', 0x0327}, {'S', 0x0327}},
+                {"tr az", 'u', 1, {'u', 0x0308}, {'U', 0x0308}},
+                {"pl", 'a', 1, {'a', 0x0328}, {'A', 0x0328}},
+                {"pl", 'c', 1, {'c', 0x0301}, {'C', 0x0301}},
+                {"pl", 'e', 1, {'e', 0x0328}, {'E', 0x0328}},
+                {"pl", 'l', 1, {0x0142}, {0x0141}},
+                {"pl", 'n', 1, {'n', 0x0301}, {'N', 0x0301}},
+                {"pl", 'o', 1, {'o', 0x0301}, {'O', 0x0301}},
+                {"pl", 's', 1, {'s', 0x0301}, {'S', 0x0301}},
+                {"pl", 'z', 1, {'z', 0x0301}, {'Z', 0x0301}},
+                {"pl", 'z', 2, {'z', 0x0307}, {'Z', 0x0307}},
+                {"cs sk", 'c', 1, {'c', 0x030C}, {'C', 0x030C}},
+                {"cs sk", 'h', 1, {'c', 'h'}, {'C', 'h'}},
+                {"cs sk", 'h', 1, {'c', 'H'}, {'C', 'H'}},
+                {"cs sk", 'r', 1, {'r', 0x030C}, {'R', 0x030C}},
+                {"cs sk", 's', 1, {'s', 0x030C}, {'S', 0x030C}},
+                {"cs sk", 'z', 1, {'z', 0x030C}, {'Z', 0x030C}}
+            };
+
+            count = sizeof(rules) / sizeof(rules[0]);
+            return rules;
+        }
+
+        static bool matchesLanguage(const char* languages, const std::string& code) {
+            std::string list = std::string(" ") + languages + " ";
+
+            return !code.empty() && list.find(" " + code + " ") != std::string::npos;
+        }
+
+        static std::uint16_t letterPrimary(char letter) {
+            return static_cast<std::uint16_t>(PRIMARY_LETTER + (letter - 'a') * 0x40);
+        }
+
+        void addTailoring(const std::uint32_t* sequence, std::uint16_t primary, char tertiary) {
+            Tailoring tailoring;
+
+            for (std::size_t i = 0; i < 3 && sequence[i] != 0; ++i)
+                tailoring.sequence.push_back(sequence[i]);
+            tailoring.primary = primary;
+            tailoring.tertiary = tertiary;
+            _tailorings.push_back(tailoring);
+        }
+
+        static void appendPrimary(std::string& key, std::uint16_t primary) {
+            key += static_cast<char>(primary >> 8);
+            key += static_cast<char>(primary & 0xFF);
+        }
+
+        static void appendElement(std::string& key, std::string& secondary, std::string& tertiary,
+                                  std::uint16_t primary, char tertiaryWeight) {
+            appendPrimary(key, primary);
+            secondary += static_cast<char>(SECONDARY_BASE);
+            tertiary += tertiaryWeight;
+        }
+
+        /**
+         * @brief Secondary weight of a combining mark, in DUCET order for the common accents.
+         */
+        static char markSecondary(std::uint32_t mark) {
+            static constexpr std::uint32_t order[] = {
+                0x0301, 0x0300, 0x0306, 0x0302, 0x030C, 0x030A, 0x0308, 0x030B,
+                0x0303, 0x0307, 0x0328, 0x0327, 0x0304, 0x0323, 0x0331, 0x0326
+            };
+
+            for (std::size_t i = 0; i < sizeof(order) / sizeof(order[0]); ++i)
+                if (order[i] == mark)
+                    return static_cast<char>(0x10 + i);
+            return static_cast<char>(0x40 + (mark & 0x3F));
+        }
+
+        /**
+         * @brief Apply the longest tailoring matching at `index`.
+         *
+         * @return std::size_t Number of code points consumed, 0 if no tailoring matches.
+         */
+        std::size_t matchTailoring(const std::vector<std::uint32_t>& codes, std::size_t index,
+                                   std::string& key, std::string& secondary, std::string& tertiary) const {
+            if (!std::ranges::binary_search(_firsts, codes[index]))
+                return 0;
+            for (std::size_t t = 0; t < _tailorings.size(); ++t) {
+                const auto& sequence = _tailorings[t].sequence;
+                if (index + sequence.size() > codes.size()
+                    || !std::equal(sequence.begin(), sequence.end(), codes.begin() + index))
+                    continue;
+                appendElement(key, secondary, tertiary, _tailorings[t].primary, _tailorings[t].tertiary);
+                return sequence.size();
+            }
+            return 0;
+        }
+
+        /**
+         * @brief Append the collation elements of one code point (root order).
+         *
+         * @return std::size_t Always 1.
+         */
+        static std::size_t appendElements(std::uint32_t code, std::string& key, std::string& secondary, std::string& tertiary) {
+            if (code < 0x20 || code == 0x7F)
+                return 1; // control characters are ignorable
+
+            if (code < 0x80) {
+                if (code >= 'a' && code <= 'z')
+                    appendElement(key, secondary, tertiary, letterPrimary(static_cast<char>(code)), TERTIARY_LOWER);
+                else if (code >= 'A' && code <= 'Z')
+                    appendElement(key, secondary, tertiary, letterPrimary(static_cast<char>(code - 'A' + 'a')), TERTIARY_UPPER);
+                else if (code >= '0' && code <= '9')
+                    appendElement(key, secondary, tertiary, static_cast<std::uint16_t>(PRIMARY_DIGIT + (code - '0') * 0x10), TERTIARY_LOWER);
+                else
+                    appendElement(key, secondary, tertiary, static_cast<std::uint16_t>(PRIMARY_PUNCTUATION + code), TERTIARY_LOWER);
+                return 1;
+            }
+
+            if ((code >= 0x0300 && code < 0x0370) || UnicodeData::combiningClass(code) != 0) {
+                secondary += markSecondary(code); // diacritics only carry a secondary weight
+                return 1;
+            }
+
+            switch (code) {
+                case 0x00DF: // ß
+                    appendElement(key, secondary, tertiary, letterPrimary('s'), TERTIARY_VARIANT);
+                    appendElement(key, secondary, tertiary, letterPrimary('s'), TERTIARY_VARIANT);
+                    return 1;
+                case 0x1E9E: // ẞ
+                    appendElement(key, secondary, tertiary, letterPrimary('s'), TERTIARY_UPPER);
+                    appendElement(key, secondary, tertiary, letterPrimary('s'), TERTIARY_UPPER);
+                    return 1;
+                case 0x00E6: case 0x00C6: // æ Æ
+                    appendElement(key, secondary, tertiary, letterPrimary('a'), code == 0x00E6 ? TERTIARY_VARIANT : TERTIARY_UPPER);
+                    appendElement(key, secondary, tertiary, letterPrimary('e'), code == 0x00E6 ? TERTIARY_VARIANT : TERTIARY_UPPER);
+                    return 1;
+                case 0x0153: case 0x0152: // œ Œ
+                    appendElement(key, secondary, tertiary, letterPrimary('o'), code == 0x0153 ? TERTIARY_VARIANT : TERTIARY_UPPER);
+                    appendElement(key, secondary, tertiary, letterPrimary('e'), code == 0x0153 ? TERTIARY_VARIANT : TERTIARY_UPPER);
+                    return 1;
+                case 0x00F8: case 0x00D8: // ø Ø
+                case 0x0111: case 0x0110: // đ Đ
+                case 0x0142: case 0x0141: // ł Ł
+                case 0x0127: case 0x0126: { // ħ Ħ
+                    char base = code == 0x00F8 || code == 0x00D8 ? 'o' : code == 0x0111 || code == 0x0110 ? 'd'
+                              : code == 0x0142 || code == 0x0141 ? 'l' : 'h';
+                    bool upper = code == 0x00D8 || code == 0x0110 || code == 0x0141 || code == 0x0126;
+                    appendElement(key, secondary, tertiary, letterPrimary(base), upper ? TERTIARY_UPPER : TERTIARY_LOWER);
+                    secondary += static_cast<char>(SECONDARY_STROKE);
+                    return 1;
+                }
+                case 0x00FE: case 0x00DE: // þ Þ
+                    appendElement(key, secondary, tertiary, static_cast<std::uint16_t>(letterPrimary('z') + 0x20),
+                                  code == 0x00FE ? TERTIARY_LOWER : TERTIARY_UPPER);
+                    return 1;
+                case 0x0131: // ı
+                    appendElement(key, secondary, tertiary, static_cast<std::uint16_t>(letterPrimary('i') + 1), TERTIARY_LOWER);
+                    return 1;
+                default:
+                    break;
+            }
+
+            if ((code >= 0x0391 && code <= 0x03A9 && code != 0x03A2) || (code >= 0x03B1 && code <= 0x03C9)) {
+                bool upper = code <= 0x03A9;
+                std::uint32_t lower = upper ? code + 0x20 : code;
+                if (lower == 0x03C2) // final sigma
+                    appendElement(key, secondary, tertiary, static_cast<std::uint16_t>(PRIMARY_GREEK + (0x03C3 - 0x03B1) * 0x10), TERTIARY_VARIANT);
+                else
+                    appendElement(key, secondary, tertiary, static_cast<std::uint16_t>(PRIMARY_GREEK + (lower - 0x03B1) * 0x10),
+                                  upper ? TERTIARY_UPPER : TERTIARY_LOWER);
+                return 1;
+            }
+            if (code >= 0x0400 && code <= 0x045F) {
+                bool upper = code < 0x0430;
+                std::uint32_t lower = code < 0x0410 ? code + 0x50 : upper ? code + 0x20 : code;
+                std::uint16_t primary = lower < 0x0450
+                    ? static_cast<std::uint16_t>(PRIMARY_CYRILLIC + (lower - 0x0430) * 0x10)
+                    : static_cast<std::uint16_t>(PRIMARY_CYRILLIC + 0x400 + (lower - 0x0450) * 0x10);
+                appendElement(key, secondary, tertiary, primary, upper ? TERTIARY_UPPER : TERTIARY_LOWER);
+                return 1;
+            }
+
+            // Implicit weights (UCA 10.1): code point order after every explicit weight.
+            appendPrimary(key, static_cast<std::uint16_t>(PRIMARY_IMPLICIT + (code >> 15)));
+            appendElement(key, secondary, tertiary, static_cast<std::uint16_t>((code & 0x7FFF) | 0x8000), TERTIARY_LOWER);
+            return 1;
+        }
+
+};
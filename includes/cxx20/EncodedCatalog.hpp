@@ -0,0 +1,133 @@
+/**
+ * @file EncodedCatalog.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <string_view>
+#include <concepts>
+
+#include "Utf8.hpp"
+#include "Catalog.hpp"
+
+/**
+ * @brief Every string of a Catalog transcoded to UTF-16 or UTF-32, in one pool.
+ *
+ * The strings are transcoded once, back to back in a single buffer, each one
+ * null-terminated: a lookup returns a pointer into the pool, without copy,
+ * ready for APIs taking wide strings (e.g. `QString::fromRawData`, JNI
+ * `NewString`). Built from a snapshot of the catalog, it does not follow
+ * later modifications.
+ *
+ * Example usage:
+ * @code
+ * Utf16Catalog utf16(*catalog);
+ * std::u16string_view title = utf16.text(SignInTitle);
+ * jstring jtitle = env->NewString(reinterpret_cast<const jchar*>(title.data()), title.size());
+ * @endcode
+ *
+ * @tparam T_Unit Code unit type, char16_t (UTF-16) or char32_t (UTF-32).
+ *
+ * @see CatalogLocale::utf16
+ */
+template<typename T_Unit>
+    requires (std::same_as<T_Unit, char16_t> || std::same_as<T_Unit, char32_t>)
+class EncodedCatalog {
+
+    public:
+
+        /**
+         * @brief Transcode every string of a catalog.
+         *
+         * @param catalog Catalog to transcode, missing keys become empty strings.
+         */
+        explicit EncodedCatalog(const Catalog& catalog) : _offsets(catalog.size() + 1, 0) {
+            std::size_t bytes = 0;
+
+            for (std::size_t key = 0; key < catalog.size(); ++key)
+                if (const auto* value = catalog.find(key))
+                    bytes += value->size();
+
+            _pool.resize(bytes + catalog.size());
+            std::size_t used = 0;
+            for (std::size_t key = 0; key < catalog.size(); ++key) {
+                const auto* value = catalog.find(key);
+                _offsets[key] = used;
+                if (value)
+                    used += transcode(value->data(), value->size(), _pool.data() + used);
+                _pool[used++] = T_Unit();
+            }
+            _offsets[catalog.size()] = used;
+            _pool.resize(used);
+            _pool.shrink_to_fit();
+        }
+
+        /**
+         * @brief Get the number of keys.
+         *
+         * @return std::size_t Key count, defined or not.
+         */
+        std::size_t size() const {
+            return _offsets.size() - 1;
+        }
+
+        /**
+         * @brief Get a transcoded string.
+         *
+         * @param key Key index, must be lower than size().
+         * @return const T_Unit* Null-terminated string in the pool, empty if missing.
+         */
+        const T_Unit* data(std::size_t key) const {
+            return _pool.data() + _offsets[key];
+        }
+
+        /**
+         * @brief Get the length of a transcoded string.
+         *
+         * @param key Key index, must be lower than size().
+         * @return std::size_t Number of code units, terminating null excluded.
+         */
+        std::size_t length(std::size_t key) const {
+            return _offsets[key + 1] - _offsets[key] - 1;
+        }
+
+        /**
+         * @brief Get a transcoded string.
+         *
+         * @param key Key index, must be lower than size().
+         * @return std::basic_string_view<T_Unit> View into the pool, empty if missing.
+         */
+        std::basic_string_view<T_Unit> text(std::size_t key) const {
+            return std::basic_string_view<T_Unit>(data(key), length(key));
+        }
+
+    private:
+        std::vector<T_Unit> _pool;          // every string, null-terminated, in key order
+        std::vector<std::size_t> _offsets;  // start of each key in _pool, plus the end
+
+    private:
+        static std::size_t transcode(const char* data, std::size_t size, char16_t* out) {
+            return Utf8::toUtf16(data, size, out);
+        }
+
+        static std::size_t transcode(const char* data, std::size_t size, char32_t* out) {
+            return Utf8::toUtf32(data, size, out);
+        }
+
+};
+
+/**
+ * @brief Catalog strings in UTF-16.
+ */
+using Utf16Catalog = EncodedCatalog<char16_t>;
+
+/**
+ * @brief Catalog strings in UTF-32.
+ */
+using Utf32Catalog = EncodedCatalog<char32_t>;
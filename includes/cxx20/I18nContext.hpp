@@ -0,0 +1,982 @@
+/**
+ * @file I18nContext.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <memory>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+#include <concepts>
+#include <functional>
+#include <future>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+#include "ILocale.hpp"
+#include "ThreadPool.hpp"
+#include "Catalog.hpp"
+#include "CatalogDelta.hpp"
+#include "CatalogValidator.hpp"
+#include "CatalogLocale.hpp"
+#include "MoLocale.hpp"
+#include "CompressedLocale.hpp"
+#include "MemoryReport.hpp"
+#include "MessageCache.hpp"
+#include "Collator.hpp"
+#include "LocaleHandle.hpp"
+
+#if defined(__APPLE__)
+    #include <CoreFoundation/CoreFoundation.h>
+#elif defined(__unix__) || defined(__linux__)
+    #include <locale>
+#endif
+
+/**
+ * @brief Trait to detect whether a type is a `std::tuple`.
+ *
+ * Primary template: defaults to false.
+ *
+ * @tparam T any
+ * 
+ * @see is_tuple<std::tuple<Args...>> Partial specialization for actual tuples
+ * @see IsTuple Concept wrapper for template constraints
+ */
+template <typename T>
+struct is_tuple : std::false_type {};
+
+/**
+ * @brief Trait to detect whether a type is a `std::tuple`.
+ *
+ * Partial specialization for `std::tuple<Args...>`.
+ * Sets `value = true` for any tuple type.
+ *
+ * @tparam ...Args are parameter from Tuple
+ * 
+ * @see is_tuple<T> Primary template
+ * @see IsTuple Concept wrapper for template constraints
+ */
+template <typename... Args>
+struct is_tuple<std::tuple<Args...>> : std::true_type {};
+
+/**
+ * @brief Using is_tuple specialisation this concept verify if it's a tuple
+ * 
+ * @tparam T is the type to check
+ * 
+ * @see is_tuple<T> Primary template
+ * @see is_tuple<std::tuple<Args...>> Partial specialization
+ */
+template <typename T>
+concept IsTuple = is_tuple<T>::value;
+
+/**
+ * @brief DerivedFrom is accept supportedLocal class only
+ * 
+ * @tparam Base is the parent
+ * @tparam Derived is the child
+ */
+template <typename Base, typename Derived>
+concept DerivedFrom = std::derived_from<Base, Derived>;
+
+/**
+ * @brief Behaviour of `setLocale()` when the requested locale is still loading.
+ *
+ * @see I18nContext::loadLocalesAsync
+ */
+enum class LocaleLoadPolicy {
+    Wait,       ///< Block until the background load completes.
+    Fallback    ///< Keep the current locale and return false.
+};
+
+/**
+ * @brief Identifier of a translation variant of a locale (e.g. a copy experiment arm), 0 for the locale itself.
+ *
+ * @see I18nContext::setSupportedVariant
+ */
+using VariantId = std::uint8_t;
+
+/**
+ * @brief Set of supported locales and current selection for a specific locale type.
+ *
+ * Handles the registration of supported locales, selection of the current locale,
+ * and retrieval of localized data at runtime. Contexts are independent from each
+ * other (one per tenant, per request, ...) but share the immutable locale
+ * instances: a locale type registered by many contexts is built only once, and
+ * copying a context only copies its locale pointers.
+ *
+ * Example usage:
+ * @code
+ * I18nContext<DefaultLocale> tenant;
+ * tenant.setSupportedLocales<LocaleEn, LocaleFr>();
+ *
+ * I18nContext<DefaultLocale> other = tenant; // shares LocaleEn and LocaleFr
+ * other.setLocale("fr");
+ * @endcode
+ *
+ * @tparam T The base locale interface type that all supported locales must derive from.
+ *
+ * @see I18n for the process-wide singleton.
+ */
+template<LocaleInterface T>
+class I18nContext {
+
+    public:
+
+        /**
+         * @brief Factory building a locale, executed on a background thread by loadLocalesAsync().
+         *
+         * Returning nullptr reports the locale as unavailable: it is not
+         * registered and setLocale() returns false for its code.
+         */
+        using LocaleLoader = std::function<std::shared_ptr<T>()>;
+
+        /**
+         * @brief Build an empty context using the system locale as default.
+         */
+        I18nContext() : _systemCode(systemCode()) {}
+
+        /**
+         * @brief Register a list of supported locales using template parameter pack.
+         * 
+         * Each type must derive from `T` and be default-constructible.
+         * Sets the default locale if no locale was previously selected.
+         * @see DerivedFrom
+         * 
+         * @tparam T_Child Variadic list of locale types to register.
+         * 
+         * @see setSupportedLocales(T_Tuple)
+         * @see setSupportedLocale<T_Child>()
+         */
+        template <DerivedFrom<T>... T_Child>
+        void setSupportedLocales() {
+            // Uses a pack expansion to call injectLocale<T_Locale>() for every type in the parameter pack.
+            (this->setSupportedLocale<T_Child>(), ...); 
+            if (!_locale)
+                setDefault();
+        }
+
+        /**
+         * @brief Register supported locales using a std::tuple of types.
+         * 
+         * Each type must derive from `T` and be default-constructible.
+         * Sets the default locale if no locale was previously selected.
+         * 
+         * @tparam T_Child Variadic list of locale types to register.
+         * 
+         * @see setSupportedLocales(T_Tuple)
+         * @see setSupportedLocale<T_Child>()
+         */
+        template <IsTuple T_Tuple>
+        void setSupportedLocales() {
+            // 1. Decompose the type T_Tuple into a pack of types.
+            std::apply([this](auto... locals) {
+                (this->setSupportedLocale<std::decay_t<decltype(locals)>>(), ...);
+            }, T_Tuple{}); // T_Tuple{} creates a temporary instance just to enable std::apply
+            if (!_locale)
+                setDefault();
+        }
+
+        /**
+         * @brief Register an already built locale instance.
+         *
+         * The instance is shared, not copied: registering the same pointer in
+         * several contexts keeps a single copy of its data. It replaces a
+         * catalog registered under the same code, whose variants are dropped;
+         * so do setSupportedMoFile(), setSupportedCompressedCatalog() and the
+         * locale loaders. Sets the default locale if no locale was previously selected.
+         *
+         * @param locale Locale instance, registered under its languageCode().
+         */
+        void setSupportedLocale(const std::shared_ptr<T>& locale) {
+            if (!locale)
+                return;
+            adoptLocale(locale->languageCode(), locale);
+            if (!_locale) setDefault();
+        }
+
+        /**
+         * @brief Register a locale built over a runtime Catalog.
+         *
+         * The catalog may be a layer (e.g. "fr-CA" over "fr"): its fallback is
+         * already flattened, the locale reads every key with a single lookup.
+         * When it replaces the catalog of `code`, the registered layers and
+         * variants over the replaced catalog are rebased on it, keeping their
+         * overrides and the locale type they were registered with, and so are
+         * the layers over those.
+         * Sets the default locale if no locale was previously selected.
+         *
+         * @tparam T_Child Locale type derived from `T`, constructible from the catalog (see CatalogLocale).
+         * @param catalog Strings of the locale, registered under its languageCode().
+         */
+        template <DerivedFrom<T> T_Child>
+        void setSupportedCatalog(const std::shared_ptr<const Catalog>& catalog) {
+            registerCatalog(catalog, &makeCatalogLocale<T_Child>);
+        }
+
+        /**
+         * @brief Register a translation variant of a locale, e.g. an arm of a copy experiment.
+         *
+         * The variant is a Catalog layer over the catalog of the locale,
+         * holding only the overridden keys: its fallback is flattened into the
+         * layer's table, so a variant lookup is the same single indexed load as
+         * a normal one and only the overridden strings take memory. It is
+         * selected with setLocale(code, variant) or getHandle(code, variant),
+         * and follows the locale when setSupportedCatalog() or applyDelta()
+         * replace its parent.
+         *
+         * Example usage:
+         * @code
+         * auto shortCopy = std::make_shared<Catalog>("fr", fr);
+         * shortCopy->set(SignUpTitle, "Créer un compte");
+         * context.setSupportedVariant<LocaleCatalog>(1, shortCopy);
+         * context.getHandle("fr", 1)->getSignUpTitle(); // "Créer un compte"
+         * @endcode
+         *
+         * @tparam T_Child Locale type derived from `T`, constructible from the catalog (see CatalogLocale).
+         * @param variant Variant identifier, at least 1.
+         * @param catalog Layer over the catalog of the locale, registered under its languageCode().
+         * @return true if registered, false if `variant` is 0, `catalog` is null or
+         *         its parent is not the catalog registered for its language code.
+         */
+        template <DerivedFrom<T> T_Child>
+        bool setSupportedVariant(VariantId variant, const std::shared_ptr<const Catalog>& catalog) {
+            if (variant == 0 || !catalog || !catalog->parent() || catalog->parent() != getCatalog(catalog->languageCode()))
+                return false;
+            auto& variants = _variants[catalog->languageCode()];
+            auto& factories = _variantFactories[catalog->languageCode()];
+            if (variants.size() <= variant) {
+                variants.resize(variant + 1);
+                factories.resize(variant + 1);
+            }
+            factories[variant] = &makeCatalogLocale<T_Child>;
+            replaceLocale(variants[variant], makeCatalogLocale<T_Child>(catalog));
+            return true;
+        }
+
+        /**
+         * @brief Register a locale built over a gettext `.mo` file.
+         *
+         * The file is mapped, not parsed: strings are looked up through its hash
+         * table when the locale is read. Sets the default locale if no locale
+         * was previously selected.
+         *
+         * @tparam T_Child Locale type derived from `T`, constructible from the file (see MoLocale).
+         * @param path Path of the `.mo` file.
+         * @param code Language code to register, read from the `Language:` header if empty.
+         * @return true if registered, false if the file is not a valid `.mo` file, has no language code or its code is frozen.
+         */
+        template <DerivedFrom<T> T_Child>
+        bool setSupportedMoFile(const std::string& path, const std::string& code = {}) {
+            auto file = MoFile::open(path, code);
+
+            if (!file || file->languageCode().empty() || _frozenCodes.contains(file->languageCode()))
+                return false;
+            setSupportedLocale(std::make_shared<T_Child>(file));
+            return true;
+        }
+
+        /**
+         * @brief Register a locale built over a CompressedCatalog.
+         *
+         * Nothing is decompressed here: the block holding a string is
+         * decompressed when the locale first reads one of its keys. Sets the
+         * default locale if no locale was previously selected.
+         *
+         * @tparam T_Child Locale type derived from `T`, constructible from the catalog (see CompressedLocale).
+         * @param catalog Compressed strings of the locale, registered under its languageCode().
+         */
+        template <DerivedFrom<T> T_Child>
+        void setSupportedCompressedCatalog(const std::shared_ptr<const CompressedCatalog>& catalog) {
+            if (!catalog)
+                return;
+            setSupportedLocale(std::make_shared<T_Child>(catalog));
+        }
+
+        /**
+         * @brief Apply a CatalogDelta to a locale registered with setSupportedCatalog().
+         *
+         * A new catalog sharing every unchanged string is built from the
+         * registered one, then replaces it as setSupportedCatalog() does: a new
+         * `T_Child` replaces the locale, the layers and variants over the
+         * catalog are rebased on the snapshot, and the selection follows
+         * whichever of them is current. Contexts sharing the previous locale
+         * or catalog keep it unchanged.
+         *
+         * @tparam T_Child Locale type derived from `T`, constructible from the catalog (see CatalogLocale).
+         * @param delta Changes, at the version of the registered catalog.
+         * @return true if applied, false if no catalog has the delta's code or CatalogDelta::apply() failed.
+         */
+        template <DerivedFrom<T> T_Child>
+        bool applyDelta(const CatalogDelta& delta) {
+            auto it = _catalogs.find(delta.languageCode());
+
+            if (it == _catalogs.end())
+                return false;
+            auto snapshot = delta.apply(*it->second);
+            if (!snapshot)
+                return false;
+            setSupportedCatalog<T_Child>(snapshot);
+            return true;
+        }
+
+        /**
+         * @brief Check every catalog registered with setSupportedCatalog() against a reference one.
+         *
+         * Reports missing and extra keys, placeholder mismatches and invalid
+         * message syntax (see CatalogValidator). Runs on `pool` and the calling thread.
+         *
+         * @param referenceCode Language code of the reference catalog (e.g., "en").
+         * @param pool Workers, must not be the pool running the caller.
+         * @return std::vector<ValidationIssue> Issues sorted by language code then key, empty if consistent.
+         * A single MissingReference issue if `referenceCode` has no catalog.
+         */
+        std::vector<ValidationIssue> validateCatalogs(const std::string& referenceCode, ThreadPool& pool) const {
+            return runValidation(referenceCode, &pool);
+        }
+
+        /**
+         * @brief Check every catalog registered with setSupportedCatalog() against a reference one, on the calling thread only.
+         *
+         * @param referenceCode Language code of the reference catalog (e.g., "en").
+         * @return std::vector<ValidationIssue> Issues sorted by language code then key, empty if consistent.
+         * A single MissingReference issue if `referenceCode` has no catalog.
+         */
+        std::vector<ValidationIssue> validateCatalogs(const std::string& referenceCode) const {
+            return runValidation(referenceCode, nullptr);
+        }
+
+        /**
+         * @brief Get the catalog registered with setSupportedCatalog().
+         *
+         * @param code Language code.
+         * @return std::shared_ptr<const Catalog> Catalog, nullptr if `code` has none.
+         */
+        std::shared_ptr<const Catalog> getCatalog(const std::string& code) const {
+            auto it = _catalogs.find(code);
+
+            return it == _catalogs.end() ? nullptr : it->second;
+        }
+
+        /**
+         * @brief Sets the default locale to use if no other locale is selected.
+         *
+         * Priority:
+         * 1. System locale (if available)
+         * 2. English ("en") fallback
+         * 3. First locale accessible.
+         */
+        void setDefault() {
+            if (_supportedLocales.empty())
+                return;
+
+            if (!_systemCode.empty() && setLocale(_systemCode))
+                return;
+            if (setLocale("en"))
+                return;
+
+            selectLocale(_supportedLocales.begin()->second);
+        }
+
+        /**
+         * @brief Select a specific locale by code.
+         *
+         * If the locale is still loading in the background, the behaviour follows
+         * the LocaleLoadPolicy given to loadLocalesAsync().
+         *
+         * @param code Two-letter language code (e.g., "en", "fr").
+         * @return true if the locale was found and selected; false otherwise.
+         * @throw any exception thrown by the LocaleLoader of `code`.
+         */
+        bool setLocale(const std::string& code) {
+            auto it = _supportedLocales.find(code);
+
+            if (it == _supportedLocales.end() && adoptPendingLocale(code))
+                it = _supportedLocales.find(code);
+            if (it != _supportedLocales.end()) {
+                selectLocale(it->second);
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Select a translation variant of a locale.
+         *
+         * @param code Language code.
+         * @param variant Variant identifier, the locale itself if 0 or not registered for `code`.
+         * @return true if the locale was found and selected; false otherwise.
+         * @throw any exception thrown by the LocaleLoader of `code`.
+         *
+         * @see setSupportedVariant
+         */
+        bool setLocale(const std::string& code, VariantId variant) {
+            if (!_supportedLocales.contains(code) && !adoptPendingLocale(code))
+                return false;
+            selectLocale(findLocale(code, variant));
+            return true;
+        }
+
+        /**
+         * @brief Get the currently selected locale instance.
+         *
+         * @return T* Pointer to the current locale. nullptr if none selected.
+         */
+        T* getLocale() const {
+            return _locale.get();
+        }
+
+        /**
+         * @brief Get a handle to the currently selected locale, to carry it across threads.
+         *
+         * @return LocaleHandle<T> Handle to getLocale(), empty if none selected.
+         *
+         * @see LocaleScope
+         */
+        LocaleHandle<T> getHandle() const {
+            return LocaleHandle<T>(_locale);
+        }
+
+        /**
+         * @brief Get a handle to a registered locale without selecting it.
+         *
+         * Serves per-request locales from one context: each request carries the
+         * handle of its own language instead of switching the shared selection.
+         *
+         * @param code Language code.
+         * @return LocaleHandle<T> Handle to the locale, empty if `code` is not registered.
+         */
+        LocaleHandle<T> getHandle(const std::string& code) const {
+            auto it = _supportedLocales.find(code);
+
+            return LocaleHandle<T>(it == _supportedLocales.end() ? nullptr : it->second);
+        }
+
+        /**
+         * @brief Get a handle to a translation variant of a registered locale without selecting it.
+         *
+         * Resolved once per request: the lookups through the handle cost the
+         * same as without a variant.
+         *
+         * @param code Language code.
+         * @param variant Variant identifier, the locale itself if 0 or not registered for `code`.
+         * @return LocaleHandle<T> Handle to the variant, empty if `code` is not registered.
+         */
+        LocaleHandle<T> getHandle(const std::string& code, VariantId variant) const {
+            return LocaleHandle<T>(findLocale(code, variant));
+        }
+
+        /**
+         * @brief Get the collator of the current locale, to sort strings shown to the user.
+         *
+         * @return const Collator& getLocale()->collator(), root order if none selected.
+         */
+        const Collator& getCollator() const {
+            return _locale ? _locale->collator() : Collator::forLanguage(std::string());
+        }
+
+        /**
+         * @brief Get the case map of the current locale, for toLower/toUpper/fold.
+         *
+         * @return const CaseMap& Case map of the language of getLocale(), root rules if none selected.
+         */
+        const CaseMap& getCaseMap() const {
+            return CaseMap::forLanguage(_locale ? _locale->languageCode() : std::string());
+        }
+
+        /**
+         * @brief Get the strings of the current locale in UTF-16, cached with the locale.
+         *
+         * @return const Utf16Catalog* UTF-16 strings by key index, nullptr if the locale is not a CatalogLocale.
+         */
+        const Utf16Catalog* getUtf16() const {
+            const auto* locale = dynamic_cast<const CatalogLocale<T>*>(_locale.get());
+
+            return locale ? &locale->utf16() : nullptr;
+        }
+
+        /**
+         * @brief Get the strings of the current locale in UTF-32, cached with the locale.
+         *
+         * @return const Utf32Catalog* UTF-32 strings by key index, nullptr if the locale is not a CatalogLocale.
+         */
+        const Utf32Catalog* getUtf32() const {
+            const auto* locale = dynamic_cast<const CatalogLocale<T>*>(_locale.get());
+
+            return locale ? &locale->utf32() : nullptr;
+        }
+
+        /**
+         * @brief Format a message of the current locale, see MessageFormat.
+         *
+         * Served from the message cache when enableMessageCache() was called.
+         *
+         * @param key Key index in the catalog of the current locale.
+         * @param arguments Named arguments.
+         * @return std::string Formatted message, empty if the locale is not a CatalogLocale or `key` is out of range.
+         */
+        std::string format(std::size_t key, const FormatArguments& arguments) const {
+            const auto* locale = dynamic_cast<const CatalogLocale<T>*>(_locale.get());
+
+            if (!locale || key >= locale->catalog()->size())
+                return {};
+            if (_messageCache)
+                return _messageCache->format(*locale->catalog(), key, arguments);
+            return MessageFormat::format(locale->catalog()->text(key), arguments, locale->catalog()->languageCode());
+        }
+
+        /**
+         * @brief Cache the output of format() for repeated keys and arguments.
+         *
+         * The cache is shared by the copies of this context. Its entries are
+         * keyed by catalog id and version, so switching or reloading a locale
+         * in one copy never flushes the entries the others still use.
+         *
+         * @param capacity Maximum number of cached messages, 0 removes the cache.
+         */
+        void enableMessageCache(std::size_t capacity) {
+            _messageCache = capacity == 0 ? nullptr : std::make_shared<MessageCache>(capacity);
+        }
+
+        /**
+         * @brief Get the message cache, e.g. for its hit rate.
+         *
+         * @return std::shared_ptr<MessageCache> Cache, nullptr if enableMessageCache() was not called.
+         */
+        std::shared_ptr<MessageCache> getMessageCache() const {
+            return _messageCache;
+        }
+
+        /**
+         * @brief Report the memory used by the registered locales and their strings.
+         *
+         * Catalog-backed locales report their key table and strings, strings
+         * shared between locales (layers, delta snapshots) are counted once;
+         * `.mo` locales report their mapping; compiled-in locales hold no heap.
+         * Variants are reported after their locale as "code#variant" (e.g. "fr#1").
+         * Linear in the number of keys times the number of catalogs, cheap
+         * enough to be scraped periodically.
+         *
+         * @return MemoryReport Footprint per locale (by language code) and per key, live locale count.
+         */
+        MemoryReport memoryReport() const {
+            std::vector<std::pair<std::string, const T*>> locales;
+            FootprintCollector collector;
+
+            for (const auto& [code, locale] : _supportedLocales)
+                locales.emplace_back(code, locale.get());
+            for (const auto& [code, variants] : _variants)
+                for (std::size_t variant = 1; variant < variants.size(); ++variant)
+                    if (variants[variant])
+                        locales.emplace_back(code + "#" + std::to_string(variant), variants[variant].get());
+            std::ranges::sort(locales); // "fr#1" right after "fr": inherited strings are reported as shared
+            for (const auto& [code, locale] : locales) {
+                if (const auto* catalogLocale = dynamic_cast<const CatalogLocale<T>*>(locale))
+                    collector.addCatalog(code, *catalogLocale->catalog());
+                else if (const auto* moLocale = dynamic_cast<const MoLocale<T>*>(locale))
+                    collector.addMoFile(code, *moLocale->file());
+                else if (const auto* compressedLocale = dynamic_cast<const CompressedLocale<T>*>(locale))
+                    collector.addCompressedCatalog(code, *compressedLocale->catalog());
+                else
+                    collector.addLocale(code);
+            }
+            return collector.report();
+        }
+
+        /**
+         * @brief Get the number of registered locales, background loads excluded.
+         *
+         * @return std::size_t Locale count.
+         */
+        std::size_t size() const {
+            return _supportedLocales.size();
+        }
+
+        /**
+         * @brief Queue a locale type for loadLocalesAsync().
+         *
+         * @tparam T_Child Locale type derived from `T`. Must be default-constructible.
+         * @param code Language code the locale will be registered under.
+         */
+        template <DerivedFrom<T> T_Child>
+        void addLocaleLoader(const std::string& code) {
+            addLocaleLoader(code, [] { return std::shared_ptr<T>(sharedLocale<T_Child>()); });
+        }
+
+        /**
+         * @brief Queue a locale factory for loadLocalesAsync().
+         *
+         * @param code Language code the locale will be registered under.
+         * @param loader Factory building the locale, may be slow (I/O, parsing).
+         */
+        void addLocaleLoader(const std::string& code, LocaleLoader loader) {
+            _loaders.emplace_back(code, std::move(loader));
+        }
+
+        /**
+         * @brief Load every queued locale, the default one first.
+         *
+         * The locale that setDefault() would pick (system, "en", first queued) is
+         * built on the calling thread and selected if no locale is selected yet;
+         * if its loader returns nullptr, the next one in that order is tried.
+         * The others are built on a background ThreadPool and registered the first
+         * time they are requested.
+         *
+         * @param policy Behaviour of setLocale() on a locale not loaded yet.
+         *
+         * @see addLocaleLoader
+         * @see waitForLocales
+         */
+        void loadLocalesAsync(LocaleLoadPolicy policy = LocaleLoadPolicy::Wait) {
+            _loadPolicy = policy;
+            if (_loaders.empty())
+                return;
+
+            bool loaded = false;
+            while (!loaded && !_loaders.empty()) {
+                std::size_t first = priorityLoader();
+                loaded = adoptLocale(_loaders[first].first, _loaders[first].second());
+                _loaders.erase(_loaders.begin() + static_cast<std::ptrdiff_t>(first));
+            }
+
+            if (!_loadPool)
+                _loadPool = std::make_shared<ThreadPool>();
+            for (std::size_t i = 0; i < _loaders.size(); ++i)
+                _pendingLocales[_loaders[i].first] = _loadPool->submit(_loaders[i].second).share();
+            _loaders.clear();
+
+            if (!_locale)
+                setDefault();
+        }
+
+        /**
+         * @brief Check whether a locale can be selected without blocking.
+         *
+         * @param code Language code.
+         * @return true if the locale is registered or finished loading.
+         */
+        bool isLocaleReady(const std::string& code) const {
+            if (_supportedLocales.contains(code))
+                return true;
+
+            auto it = _pendingLocales.find(code);
+            return it != _pendingLocales.end()
+                && it->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+
+        /**
+         * @brief Block until every background load is finished and register the results.
+         *
+         * @throw any exception thrown by a LocaleLoader.
+         */
+        void waitForLocales() {
+            while (!_pendingLocales.empty()) {
+                auto node = _pendingLocales.extract(_pendingLocales.begin());
+                adoptLocale(node.key(), node.mapped().get());
+            }
+        }
+
+    protected:
+        /**
+         * @brief Make the locales registered so far permanent.
+         *
+         * Registering another locale or catalog under one of their codes is
+         * refused afterwards, so a derived context may keep typed pointers to
+         * them (see StaticI18nContext).
+         */
+        void freezeLocales() {
+            for (const auto& [code, locale] : _supportedLocales)
+                _frozenCodes.insert(code);
+        }
+
+        /**
+         * @brief Get the process-wide instance of a locale type.
+         *
+         * The instance lives as long as one context references it, so every
+         * context registering `T_Child` shares the same immutable data.
+         *
+         * @tparam T_Child Locale type derived from `T`. Must be default-constructible.
+         */
+        template <DerivedFrom<T> T_Child>
+        static std::shared_ptr<T_Child> sharedLocale() {
+            static std::mutex mutex;
+            static std::weak_ptr<T_Child> cache;
+
+            std::lock_guard lock(mutex);
+            auto instance = cache.lock();
+            if (!instance) {
+                instance = std::make_shared<T_Child>();
+                cache = instance;
+            }
+            return instance;
+        }
+
+        /**
+         * @brief Select a locale already registered in this context.
+         *
+         * @param locale Registered locale instance.
+         */
+        void selectLocale(std::shared_ptr<T> locale) {
+            _locale = std::move(locale);
+        }
+
+    private:
+        /**
+         * @brief Builds the locale of a catalog with the type it was registered with.
+         */
+        using CatalogFactory = std::function<std::shared_ptr<T>(const std::shared_ptr<const Catalog>&)>;
+
+    private:
+        std::string _systemCode;
+        std::shared_ptr<T> _locale;
+        std::unordered_map<std::string, std::shared_ptr<T>> _supportedLocales;
+        std::unordered_map<std::string, std::shared_ptr<const Catalog>> _catalogs;
+        std::unordered_map<std::string, std::vector<std::shared_ptr<T>>> _variants; // code -> locale of each variant, by VariantId
+        std::unordered_map<std::string, CatalogFactory> _catalogFactories; // code -> type its catalog was registered with
+        std::unordered_map<std::string, std::vector<CatalogFactory>> _variantFactories; // code -> type of each variant, by VariantId
+        std::unordered_set<std::string> _frozenCodes; // cannot be registered again, see freezeLocales()
+        std::vector<std::pair<std::string, LocaleLoader>> _loaders;
+        std::unordered_map<std::string, std::shared_future<std::shared_ptr<T>>> _pendingLocales;
+        LocaleLoadPolicy _loadPolicy = LocaleLoadPolicy::Wait;
+        std::shared_ptr<ThreadPool> _loadPool; // shared by the copies of this context
+        std::shared_ptr<MessageCache> _messageCache; // shared by the copies of this context
+
+    private:
+        /**
+         * @brief Get the system default locale code, detected once per process.
+         *
+         * @return const std::string& System language code, empty if unknown.
+         */
+        static const std::string& systemCode() {
+            static const std::string code = detectSystemCode();
+
+            return code;
+        }
+
+        /**
+         * @brief Detect the system default locale code.
+         *
+         * Uses platform-specific APIs:
+         * - macOS: CoreFoundation CFLocale
+         * - Linux/Unix: std::locale
+         * - Other: defaults to "en"
+         */
+        static std::string detectSystemCode() {
+             #if defined(__APPLE__)
+                CFLocaleRef locale = CFLocaleCopyCurrent();
+                if (!locale)
+                    return "en"; // fallback
+
+                CFStringRef identifier = (CFStringRef)CFLocaleGetValue(locale, kCFLocaleIdentifier);
+
+                char buffer[16] = {0};
+                std::string code = "en"; // second fallback
+                if (CFStringGetCString(identifier, buffer, sizeof(buffer), kCFStringEncodingUTF8))
+                    code = std::string(buffer, 2); // first 2 letters
+                CFRelease(locale);
+                return code;
+            #elif defined(__unix__) || defined(__linux__)
+                try {
+                    std::locale loc(""); // system locale
+                    std::string name = loc.name(); // e.g., "fr_FR.UTF-8"
+                    if (!name.empty() && name != "C" && name != "POSIX")
+                        return name.substr(0, 2);
+                    return std::string();
+                } catch (...) {
+                    return "en"; // fallback on error
+                }
+            #else
+                return "en"; // fallback for other platforms
+            #endif
+        }
+
+        /**
+         * @brief Register a single locale type.
+         *
+         * @tparam T_Child Locale type derived from `T`. Must be default-constructible.
+         *
+         * @see setSupportedLocales(T_Child...)
+         * @see setSupportedLocales(T_Tuple)
+         */
+        template <DerivedFrom<T> T_Child>
+        void setSupportedLocale() {
+            auto instance = sharedLocale<T_Child>();
+            std::string key = instance->languageCode();
+            adoptLocale(key, instance);
+        }
+
+        /**
+         * @brief Store a locale instance under `code`.
+         *
+         * If the replaced instance is the current locale, the selection moves to
+         * the new instance instead of dangling. A null instance (a LocaleLoader
+         * that failed) is not registered, nor one under a frozen code. The
+         * instance does not come from a catalog: a catalog registered under
+         * `code` and its variants are dropped.
+         *
+         * @return true if registered.
+         */
+        bool adoptLocale(const std::string& code, std::shared_ptr<T> instance) {
+            if (!instance || _frozenCodes.contains(code))
+                return false;
+            replaceLocale(_supportedLocales[code], std::move(instance));
+            forgetCatalog(code);
+            return true;
+        }
+
+        /**
+         * @brief Drop the catalog and the variants of `code`, replaced by a locale that does not come from a catalog.
+         *
+         * A selected variant falls back to the locale registered under `code`.
+         */
+        void forgetCatalog(const std::string& code) {
+            _catalogs.erase(code);
+            _catalogFactories.erase(code);
+            _variantFactories.erase(code);
+
+            auto node = _variants.extract(code);
+            if (node.empty())
+                return;
+            if (std::ranges::any_of(node.mapped(), [this](const auto& variant) { return variant && _locale == variant; }))
+                _locale = _supportedLocales[code];
+        }
+
+        /**
+         * @brief Store a locale instance in a slot, moving the selection if it was the replaced instance.
+         */
+        void replaceLocale(std::shared_ptr<T>& slot, std::shared_ptr<T> instance) {
+            if (slot && _locale == slot)
+                _locale = instance;
+            slot = std::move(instance);
+        }
+
+        /**
+         * @brief Validate the catalogs against the one of `referenceCode`, on `pool` if not null.
+         */
+        std::vector<ValidationIssue> runValidation(const std::string& referenceCode, ThreadPool* pool) const {
+            auto reference = getCatalog(referenceCode);
+
+            if (!reference)
+                return {{ValidationError::MissingReference, referenceCode, {}, "no catalog registered for the reference"}};
+
+            CatalogValidator validator(reference);
+            for (const auto& [code, catalog] : _catalogs)
+                validator.add(catalog);
+            return pool ? validator.validate(*pool) : validator.validate();
+        }
+
+        /**
+         * @brief Get the locale of a variant, falling back to the locale itself.
+         *
+         * @return std::shared_ptr<T> Locale instance, nullptr if `code` is not registered.
+         */
+        std::shared_ptr<T> findLocale(const std::string& code, VariantId variant) const {
+            if (variant) {
+                if (auto it = _variants.find(code); it != _variants.end() && variant < it->second.size() && it->second[variant])
+                    return it->second[variant];
+            }
+            auto it = _supportedLocales.find(code);
+            return it == _supportedLocales.end() ? nullptr : it->second;
+        }
+
+        /**
+         * @brief Build a `T_Child` over a catalog, stored to rebuild the locale when its catalog is rebased.
+         */
+        template <DerivedFrom<T> T_Child>
+        static std::shared_ptr<T> makeCatalogLocale(const std::shared_ptr<const Catalog>& catalog) {
+            return std::make_shared<T_Child>(catalog);
+        }
+
+        /**
+         * @brief Register a catalog and its locale, then rebase the layers and variants over the catalog it replaces.
+         */
+        void registerCatalog(const std::shared_ptr<const Catalog>& catalog, CatalogFactory factory) {
+            if (!catalog || _frozenCodes.contains(catalog->languageCode()))
+                return;
+            const auto& code = catalog->languageCode();
+            auto previous = getCatalog(code);
+
+            _catalogs[code] = catalog;
+            _catalogFactories[code] = factory;
+            replaceLocale(_supportedLocales[code], factory(catalog));
+            if (!_locale) setDefault();
+            if (previous)
+                rebaseLayers(code, previous, catalog);
+        }
+
+        /**
+         * @brief Move the layers and variants over `previous` onto its replacement, keeping their overrides and types.
+         *
+         * A rebased layer is registered again, which rebases the layers over it in turn.
+         */
+        void rebaseLayers(const std::string& code, const std::shared_ptr<const Catalog>& previous, const std::shared_ptr<const Catalog>& catalog) {
+            if (auto it = _variants.find(code); it != _variants.end()) {
+                const auto& factories = _variantFactories[code];
+                for (std::size_t variant = 1; variant < it->second.size(); ++variant) {
+                    const auto* locale = dynamic_cast<const CatalogLocale<T>*>(it->second[variant].get());
+                    if (!locale || locale->catalog()->parent() != previous)
+                        continue;
+                    replaceLocale(it->second[variant], factories[variant](rebasedLayer(*locale->catalog(), catalog)));
+                }
+            }
+
+            std::vector<std::string> layers;
+            for (const auto& [layerCode, layer] : _catalogs)
+                if (layerCode != code && layer->parent() == previous)
+                    layers.push_back(layerCode);
+            for (const auto& layerCode : layers)
+                registerCatalog(rebasedLayer(*_catalogs[layerCode], catalog), _catalogFactories[layerCode]);
+        }
+
+        /**
+         * @brief Copy a layer over `parent`, keeping its overrides.
+         */
+        static std::shared_ptr<const Catalog> rebasedLayer(const Catalog& layer, const std::shared_ptr<const Catalog>& parent) {
+            auto copy = std::make_shared<Catalog>(layer);
+
+            copy->rebase(parent);
+            return copy;
+        }
+
+        /**
+         * @brief Register a background-loaded locale, honouring the load policy.
+         *
+         * @return true if `code` is now registered, false if still loading or its loader returned nullptr.
+         */
+        bool adoptPendingLocale(const std::string& code) {
+            auto it = _pendingLocales.find(code);
+
+            if (it == _pendingLocales.end())
+                return false;
+            if (_loadPolicy == LocaleLoadPolicy::Fallback
+                && it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                return false;
+
+            auto node = _pendingLocales.extract(it);
+            return adoptLocale(code, node.mapped().get());
+        }
+
+        /**
+         * @brief Index of the queued loader setDefault() would select.
+         */
+        std::size_t priorityLoader() const {
+            for (std::size_t i = 0; i < _loaders.size(); ++i)
+                if (!_systemCode.empty() && _loaders[i].first == _systemCode)
+                    return i;
+            for (std::size_t i = 0; i < _loaders.size(); ++i)
+                if (_loaders[i].first == "en")
+                    return i;
+            return 0;
+        }
+
+};
@@ -0,0 +1,228 @@
+/**
+ * @file LocaleRegistry.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <array>
+#include <string_view>
+#include <tuple>
+#include <cstddef>
+#include <algorithm>
+#include <concepts>
+
+#include "ILocale.hpp"
+#include "I18nContext.hpp"
+
+/**
+ * @brief String literal usable as a template argument (e.g. `setLocale<"fr">()`).
+ *
+ * @tparam N Size of the literal, terminating null included.
+ */
+template <std::size_t N>
+struct FixedString {
+    char value[N] = {};
+
+    constexpr FixedString(const char (&text)[N]) {
+        std::copy_n(text, N, value);
+    }
+
+    /**
+     * @brief View of the string, without the terminating null.
+     */
+    constexpr std::string_view view() const {
+        return std::string_view(value, N - 1);
+    }
+};
+
+/**
+ * @brief Locale type declaring its language code at compile time.
+ *
+ * Example usage:
+ * @code
+ * class LocaleFr : public DefaultLocale {
+ *     public:
+ *         static constexpr const char* code = "fr";
+ *         const std::string languageCode() const override { return code; }
+ * };
+ * @endcode
+ *
+ * @tparam T Locale type.
+ */
+template <typename T>
+concept StaticLocale = requires {
+    { std::string_view(T::code) } -> std::same_as<std::string_view>;
+};
+
+/**
+ * @brief Compile-time table of the language codes of a tuple of locales.
+ *
+ * Primary template, only tuples of StaticLocale types derived from `T` have a registry.
+ *
+ * @tparam T The base locale interface type.
+ * @tparam T_Tuple std::tuple of locale types (e.g. SupportedLocales).
+ */
+template <LocaleInterface T, IsTuple T_Tuple>
+class LocaleRegistry;
+
+/**
+ * @brief Compile-time table of the language codes of a tuple of locales.
+ *
+ * Example usage:
+ * @code
+ * using Registry = LocaleRegistry<DefaultLocale, std::tuple<LocaleEn, LocaleFr>>;
+ * static_assert(Registry::indexOf("fr") == 1);
+ * static_assert(!Registry::contains("de"));
+ * @endcode
+ *
+ * @tparam T The base locale interface type.
+ * @tparam T_Child Locale types, each derived from `T` with a static `code`.
+ */
+template <LocaleInterface T, DerivedFrom<T>... T_Child>
+    requires (StaticLocale<T_Child> && ...)
+class LocaleRegistry<T, std::tuple<T_Child...>> {
+
+    public:
+
+        /**
+         * @brief Returned by indexOf() for an unknown code.
+         */
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        /**
+         * @brief Language codes, in tuple order.
+         */
+        static constexpr std::array<std::string_view, sizeof...(T_Child)> codes = {std::string_view(T_Child::code)...};
+
+        /**
+         * @brief Get the tuple index of a language code.
+         *
+         * @param code Language code.
+         * @return std::size_t Index in the tuple, npos if unknown.
+         */
+        static consteval std::size_t indexOf(std::string_view code) {
+            for (std::size_t i = 0; i < codes.size(); ++i)
+                if (codes[i] == code)
+                    return i;
+            return npos;
+        }
+
+        /**
+         * @brief Check whether a language code is in the tuple.
+         *
+         * @param code Language code.
+         * @return true if one of the locale types declares `code`.
+         */
+        static consteval bool contains(std::string_view code) {
+            return indexOf(code) != npos;
+        }
+
+        /**
+         * @brief Locale type declaring a language code.
+         *
+         * @tparam Code Language code, must be in the tuple.
+         */
+        template <FixedString Code>
+            requires (contains(Code.view()))
+        using Locale = std::tuple_element_t<indexOf(Code.view()), std::tuple<T_Child...>>;
+
+    private:
+        static consteval bool hasUniqueCodes() {
+            for (std::size_t i = 0; i < codes.size(); ++i)
+                if (indexOf(codes[i]) != i)
+                    return false;
+            return true;
+        }
+
+        static_assert(hasUniqueCodes(), "Two locale types declare the same language code.");
+
+};
+
+/**
+ * @brief I18nContext over a tuple of locales known at compile time.
+ *
+ * The locales of the tuple are registered on construction and also kept in
+ * a fixed slot per type: `setLocale<"fr">()` and `getLocale<"fr">()` resolve
+ * the slot at compile time, without hashing the code, and an unknown code is
+ * a compile error. Runtime codes keep working through the I18nContext API.
+ * The locales of the tuple are permanent: registering another locale or
+ * catalog under one of their codes is refused (setSupportedCatalog() does
+ * nothing, a LocaleLoader result is dropped), so a slot never serves a
+ * replaced instance. Other codes can be registered and replaced as usual.
+ *
+ * Example usage:
+ * @code
+ * StaticI18nContext<DefaultLocale, SupportedLocales> i18n;
+ * i18n.setLocale<"fr">();
+ * i18n.getLocale<"fr">()->getSignInTitle(); // LocaleFr*, "Connexion"
+ * i18n.setLocale<"xx">(); // does not compile
+ * @endcode
+ *
+ * @tparam T The base locale interface type.
+ * @tparam T_Tuple std::tuple of StaticLocale types derived from `T`.
+ */
+template <LocaleInterface T, IsTuple T_Tuple>
+class StaticI18nContext : public I18nContext<T> {
+
+    public:
+
+        /**
+         * @brief Compile-time table of the codes of `T_Tuple`.
+         */
+        using Registry = LocaleRegistry<T, T_Tuple>;
+
+        using I18nContext<T>::setLocale;
+        using I18nContext<T>::getLocale;
+
+        /**
+         * @brief Register every locale of `T_Tuple`, freeze their codes and select the default one.
+         */
+        StaticI18nContext() : _slots(makeSlots(std::make_index_sequence<std::tuple_size_v<T_Tuple>>{})) {
+            this->template setSupportedLocales<T_Tuple>();
+            this->freezeLocales();
+        }
+
+        /**
+         * @brief Select a locale by a code checked at compile time.
+         *
+         * @tparam Code Language code, must be declared by a locale of `T_Tuple`.
+         */
+        template <FixedString Code>
+            requires (Registry::contains(Code.view()))
+        void setLocale() {
+            this->selectLocale(std::get<Registry::indexOf(Code.view())>(_slots));
+        }
+
+        /**
+         * @brief Get a locale by a code checked at compile time, whatever the current selection.
+         *
+         * @tparam Code Language code, must be declared by a locale of `T_Tuple`.
+         * @return Registry::Locale<Code>* The concrete locale type, never nullptr.
+         */
+        template <FixedString Code>
+            requires (Registry::contains(Code.view()))
+        typename Registry::template Locale<Code>* getLocale() const {
+            return std::get<Registry::indexOf(Code.view())>(_slots).get();
+        }
+
+    private:
+        template <typename T_Slots>
+        struct SlotsOf;
+
+        template <typename... T_Child>
+        struct SlotsOf<std::tuple<T_Child...>> {
+            using type = std::tuple<std::shared_ptr<T_Child>...>;
+        };
+
+        typename SlotsOf<T_Tuple>::type _slots;
+
+    private:
+        template <std::size_t... Is>
+        static typename SlotsOf<T_Tuple>::type makeSlots(std::index_sequence<Is...>) {
+            return {I18nContext<T>::template sharedLocale<std::tuple_element_t<Is, T_Tuple>>()...};
+        }
+
+};
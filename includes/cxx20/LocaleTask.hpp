@@ -0,0 +1,316 @@
+/**
+ * @file LocaleTask.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+#include "ILocale.hpp"
+#include "LocaleHandle.hpp"
+
+/**
+ * @brief Get the awaiter `co_await awaitable` would use: its member or free `operator co_await`, or itself.
+ */
+template<typename A>
+decltype(auto) localeAwaiterOf(A&& awaitable) {
+    if constexpr (requires { std::forward<A>(awaitable).operator co_await(); })
+        return std::forward<A>(awaitable).operator co_await();
+    else if constexpr (requires { operator co_await(std::forward<A>(awaitable)); })
+        return operator co_await(std::forward<A>(awaitable));
+    else
+        return std::forward<A>(awaitable);
+}
+
+/**
+ * @brief Awaiter storage: a reference for lvalue awaiters, a value otherwise.
+ */
+template<typename A>
+using LocaleAwaiterStorage = std::conditional_t<std::is_lvalue_reference_v<decltype(localeAwaiterOf(std::declval<A>()))>,
+    decltype(localeAwaiterOf(std::declval<A>())), std::remove_cvref_t<decltype(localeAwaiterOf(std::declval<A>()))>>;
+
+/**
+ * @brief Awaiter forwarding to another one and making a locale current when the coroutine resumes.
+ *
+ * Returned by withLocale(). Costs a single thread-local handle store per resume.
+ *
+ * @tparam T The base locale interface type.
+ * @tparam A Wrapped awaitable type.
+ */
+template<LocaleInterface T, typename A>
+class LocaleAwaiter {
+
+    public:
+
+        /**
+         * @brief Wrap an awaitable.
+         *
+         * @param locale Locale current after the resume.
+         * @param awaitable Awaitable deciding when and where the coroutine resumes.
+         */
+        LocaleAwaiter(LocaleHandle<T> locale, A&& awaitable)
+            : _locale(locale), _awaiter(localeAwaiterOf(std::forward<A>(awaitable))) {}
+
+        bool await_ready() {
+            return _awaiter.await_ready();
+        }
+
+        template<typename P>
+        decltype(auto) await_suspend(std::coroutine_handle<P> coroutine) {
+            return _awaiter.await_suspend(coroutine);
+        }
+
+        decltype(auto) await_resume() {
+            LocaleHandle<T>::setCurrent(_locale);
+            return _awaiter.await_resume();
+        }
+
+    private:
+        LocaleHandle<T> _locale;
+        LocaleAwaiterStorage<A> _awaiter;
+
+};
+
+/**
+ * @brief Make a locale current when the coroutine resumes from `awaitable`, on whichever thread.
+ *
+ * Awaitable adapter for any coroutine type: wrap the awaits that may hop to
+ * another thread (executor schedule, I/O completion, ...).
+ *
+ * Example usage:
+ * @code
+ * co_await withLocale(request.locale, pool.schedule());
+ * LocaleHandle<DefaultLocale>::current(); // request.locale, on the pool thread
+ * @endcode
+ *
+ * @param locale Locale current after the resume.
+ * @param awaitable Awaitable to forward to.
+ * @return LocaleAwaiter<T, A> Awaiter with the result of `awaitable`.
+ */
+template<LocaleInterface T, typename A>
+LocaleAwaiter<T, A> withLocale(LocaleHandle<T> locale, A&& awaitable) {
+    return LocaleAwaiter<T, A>(locale, std::forward<A>(awaitable));
+}
+
+/**
+ * @brief Eager coroutine task carrying a locale across suspensions and thread hops.
+ *
+ * The task is bound to the locale current where it is created, or to the
+ * LocaleHandle passed as its first argument. Every `co_await` in its body is
+ * adapted: the bound locale is made current when the task resumes, and the
+ * resuming thread gets its own locale back when the task suspends or ends,
+ * so pool threads and the creating thread are left as they were. That is one
+ * thread-local handle store on each side of a suspension.
+ *
+ * The body starts running in the creating thread. Destroying the task
+ * detaches a running body, which then frees itself when it completes.
+ *
+ * Example usage:
+ * @code
+ * LocaleTask<DefaultLocale> render(ThreadPool& pool) {
+ *     co_await schedule(pool);                                  // resumes on a worker
+ *     LocaleHandle<DefaultLocale>::current()->getSignInTitle(); // still the caller's locale
+ * }
+ *
+ * LocaleScope<DefaultLocale> scope(tenant.getHandle("fr"));
+ * LocaleTask<DefaultLocale> task = render(pool);
+ * task.get();
+ * @endcode
+ *
+ * @tparam T The base locale interface type.
+ *
+ * @see withLocale for other coroutine types.
+ */
+template<LocaleInterface T>
+class LocaleTask {
+
+    public:
+
+        /**
+         * @brief Coroutine promise: bound locale, completion state and exception.
+         */
+        class promise_type {
+
+            public:
+
+                /**
+                 * @brief Bind the task to the locale current on the creating thread.
+                 */
+                promise_type() = default;
+
+                /**
+                 * @brief Bind the task to the locale given as first coroutine argument.
+                 */
+                template<typename... A>
+                explicit promise_type(LocaleHandle<T> locale, A&&...) : _locale(locale) {}
+
+                LocaleTask get_return_object() {
+                    return LocaleTask(std::coroutine_handle<promise_type>::from_promise(*this));
+                }
+
+                auto initial_suspend() noexcept {
+                    struct Start {
+                        promise_type& promise;
+                        bool await_ready() const noexcept { return true; }
+                        void await_suspend(std::coroutine_handle<>) const noexcept {}
+                        void await_resume() const noexcept { promise.enter(); }
+                    };
+                    return Start{*this};
+                }
+
+                auto final_suspend() noexcept {
+                    struct Finish {
+                        promise_type& promise;
+                        bool await_ready() const noexcept { return false; }
+                        bool await_suspend(std::coroutine_handle<>) const noexcept {
+                            promise.leave();
+                            promise._finished.store(true, std::memory_order_release);
+                            promise._finished.notify_all();
+                            // The second of the body and the task object to let go frees the frame.
+                            return !promise._released.exchange(true, std::memory_order_acq_rel);
+                        }
+                        void await_resume() const noexcept {}
+                    };
+                    return Finish{*this};
+                }
+
+                void return_void() {}
+
+                void unhandled_exception() {
+                    _exception = std::current_exception();
+                }
+
+                /**
+                 * @brief Adapt every `co_await` of the body to carry the locale.
+                 */
+                template<typename A>
+                auto await_transform(A&& awaitable) {
+                    return Awaiter<A>(*this, std::forward<A>(awaitable));
+                }
+
+            private:
+                template<typename A>
+                class Awaiter {
+
+                    public:
+
+                        Awaiter(promise_type& promise, A&& awaitable)
+                            : _promise(promise), _awaiter(localeAwaiterOf(std::forward<A>(awaitable))) {}
+
+                        bool await_ready() {
+                            return _awaiter.await_ready();
+                        }
+
+                        template<typename P>
+                        decltype(auto) await_suspend(std::coroutine_handle<P> coroutine) {
+                            // Before handing the coroutine over: it may resume on another thread at once.
+                            _promise.leave();
+                            return _awaiter.await_suspend(coroutine);
+                        }
+
+                        decltype(auto) await_resume() {
+                            _promise.enter();
+                            return _awaiter.await_resume();
+                        }
+
+                    private:
+                        promise_type& _promise;
+                        LocaleAwaiterStorage<A> _awaiter;
+
+                };
+
+            private:
+                LocaleHandle<T> _locale = LocaleHandle<T>::current();
+                LocaleHandle<T> _outer;     // locale of the thread running the body, restored on leave()
+                std::exception_ptr _exception;
+                std::atomic<bool> _finished = false;
+                std::atomic<bool> _released = false;
+
+                friend class LocaleTask;
+
+            private:
+                void enter() {
+                    _outer = LocaleHandle<T>::current();
+                    LocaleHandle<T>::setCurrent(_locale);
+                }
+
+                void leave() {
+                    LocaleHandle<T>::setCurrent(_outer);
+                }
+
+        };
+
+        /**
+         * @brief Move constructor
+         */
+        LocaleTask(LocaleTask&& other) noexcept : _coroutine(std::exchange(other._coroutine, nullptr)) {}
+
+        /**
+         * @brief Move assignment
+         */
+        LocaleTask& operator=(LocaleTask&& other) noexcept {
+            if (this != &other) {
+                release();
+                _coroutine = std::exchange(other._coroutine, nullptr);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Free the coroutine, or detach it if still running.
+         */
+        ~LocaleTask() {
+            release();
+        }
+
+        /**
+         * @brief Get the locale the task is bound to.
+         *
+         * @return LocaleHandle<T> Bound locale.
+         */
+        LocaleHandle<T> locale() const {
+            return _coroutine.promise()._locale;
+        }
+
+        /**
+         * @brief Check whether the body completed.
+         *
+         * @return true if the body returned or threw.
+         */
+        bool done() const {
+            return _coroutine.promise()._finished.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Block until the body completes.
+         *
+         * @throw any exception escaping the body.
+         */
+        void get() const {
+            auto& promise = _coroutine.promise();
+
+            promise._finished.wait(false, std::memory_order_acquire);
+            if (promise._exception)
+                std::rethrow_exception(promise._exception);
+        }
+
+    private:
+        std::coroutine_handle<promise_type> _coroutine;
+
+    private:
+        explicit LocaleTask(std::coroutine_handle<promise_type> coroutine) : _coroutine(coroutine) {}
+
+        void release() {
+            if (_coroutine && _coroutine.promise()._released.exchange(true, std::memory_order_acq_rel))
+                _coroutine.destroy();
+            _coroutine = nullptr;
+        }
+
+};
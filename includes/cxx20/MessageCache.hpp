@@ -0,0 +1,252 @@
+/**
+ * @file MessageCache.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <unordered_map>
+#include <span>
+
+#include "Catalog.hpp"
+#include "MessageFormat.hpp"
+#include "Binary.hpp"
+
+/**
+ * @brief Counters of a MessageCache.
+ */
+struct MessageCacheStats {
+    std::uint64_t hits;         ///< Lookups answered from the cache.
+    std::uint64_t misses;       ///< Lookups that ran the formatter.
+    std::uint64_t evictions;    ///< Entries dropped to respect the capacity.
+    std::size_t size;           ///< Entries currently stored.
+
+    /**
+     * @brief Get the share of lookups answered from the cache.
+     *
+     * @return double Hits over lookups, 0 before the first lookup.
+     */
+    double hitRate() const {
+        return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(hits + misses);
+    }
+};
+
+/**
+ * @brief Bounded cache of formatted messages, keyed by catalog, key and arguments.
+ *
+ * The entries are spread over independently locked shards, each one evicting
+ * its least recently used entry when full, so concurrent lookups rarely wait
+ * on each other. The formatter runs outside the locks.
+ *
+ * invalidate() starts a new generation in O(1): entries of older generations
+ * are never returned and are replaced or evicted as they are met. A catalog is
+ * identified by its Catalog::id() and version: ids are never reused, so the
+ * entries of a reloaded catalog are never returned and age out without any
+ * invalidation, and contexts switching locales share a cache without
+ * flushing each other. invalidate() is only needed after editing a catalog
+ * in place without changing its version.
+ *
+ * Example usage:
+ * @code
+ * MessageCache cache(4096);
+ * FormatArguments arguments;
+ * arguments.add("count", unread);
+ * label = cache.format(*catalog, NewMessages, arguments); // formatter runs once per distinct count
+ * cache.stats().hitRate();
+ * @endcode
+ *
+ * @see I18nContext::enableMessageCache
+ */
+class MessageCache {
+
+    public:
+
+        /**
+         * @brief Number of shards used when none is given.
+         */
+        static constexpr std::size_t DEFAULT_SHARDS = 16;
+
+        /**
+         * @brief Build an empty cache.
+         *
+         * @param capacity Maximum number of entries, 0 disables caching.
+         * @param shards Number of independently locked shards, at least 1.
+         */
+        explicit MessageCache(std::size_t capacity, std::size_t shards = DEFAULT_SHARDS)
+            : _shardCount(shards == 0 ? 1 : shards), _shards(std::make_unique<Shard[]>(_shardCount)),
+              _shardCapacity(capacity == 0 ? 0 : (capacity + _shardCount - 1) / _shardCount),
+              _generation(0), _hits(0), _misses(0), _evictions(0) {}
+
+        /**
+         * @brief delete Copy constructor
+         */
+        MessageCache(const MessageCache&) = delete;
+
+        /**
+         * @brief delete Copy assignment
+         */
+        MessageCache& operator=(const MessageCache&) = delete;
+
+        /**
+         * @brief Format a message of a catalog, or return the output of an identical previous call.
+         *
+         * @param catalog Catalog holding the message.
+         * @param key Key index, must be lower than catalog.size().
+         * @param arguments Named arguments.
+         * @return std::string Formatted message, see MessageFormat::format().
+         */
+        std::string format(const Catalog& catalog, std::size_t key, const FormatArguments& arguments) {
+            const auto hash = entryHash(catalog, key, arguments);
+            const auto generation = _generation.load(std::memory_order_acquire);
+            auto& shard = _shards[(hash >> 32) % _shardCount];
+
+            {
+                std::lock_guard lock(shard.mutex);
+                auto it = shard.index.find(hash);
+                if (it != shard.index.end() && it->second->generation == generation && matches(*it->second, catalog, key, arguments)) {
+                    shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+                    _hits.fetch_add(1, std::memory_order_relaxed);
+                    return it->second->output;
+                }
+            }
+
+            _misses.fetch_add(1, std::memory_order_relaxed);
+            auto output = MessageFormat::format(catalog.text(key), arguments, catalog.languageCode());
+            if (_shardCapacity > 0)
+                store(shard, hash, generation, catalog, key, arguments, output);
+            return output;
+        }
+
+        /**
+         * @brief Drop every entry logically, in O(1): later lookups run the formatter again.
+         */
+        void invalidate() {
+            _generation.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        /**
+         * @brief Release the memory of every entry now.
+         */
+        void clear() {
+            for (auto& shard : std::span(_shards.get(), _shardCount)) {
+                std::lock_guard lock(shard.mutex);
+                shard.entries.clear();
+                shard.index.clear();
+            }
+        }
+
+        /**
+         * @brief Get the maximum number of entries.
+         *
+         * @return std::size_t Capacity, rounded up to a multiple of the shard count.
+         */
+        std::size_t capacity() const {
+            return _shardCapacity * _shardCount;
+        }
+
+        /**
+         * @brief Get the hit, miss and eviction counters.
+         *
+         * @return MessageCacheStats Counters since construction.
+         */
+        MessageCacheStats stats() const {
+            MessageCacheStats stats{
+                _hits.load(std::memory_order_relaxed),
+                _misses.load(std::memory_order_relaxed),
+                _evictions.load(std::memory_order_relaxed),
+                0
+            };
+
+            for (const auto& shard : std::span(_shards.get(), _shardCount)) {
+                std::lock_guard lock(shard.mutex);
+                stats.size += shard.entries.size();
+            }
+            return stats;
+        }
+
+    private:
+        struct Entry {
+            std::uint64_t hash;
+            std::uint64_t generation;
+            std::uint64_t catalog;  // Catalog::id()
+            std::uint64_t version;
+            std::size_t key;
+            std::string arguments;
+            std::string output;
+        };
+
+        /**
+         * @brief Entries of a shard, most recently used first, indexed by hash.
+         */
+        struct Shard {
+            mutable std::mutex mutex;
+            std::list<Entry> entries;
+            std::unordered_map<std::uint64_t, std::list<Entry>::iterator> index;
+        };
+
+    private:
+        std::size_t _shardCount;
+        std::unique_ptr<Shard[]> _shards;
+        std::size_t _shardCapacity;
+        std::atomic<std::uint64_t> _generation;
+        std::atomic<std::uint64_t> _hits;
+        std::atomic<std::uint64_t> _misses;
+        std::atomic<std::uint64_t> _evictions;
+
+    private:
+        /**
+         * @brief Hash of (catalog, version, key, arguments): FNV-1a over the arguments, mixed with the rest.
+         */
+        static std::uint64_t entryHash(const Catalog& catalog, std::size_t key, const FormatArguments& arguments) {
+            const auto& packed = arguments.packed();
+            std::uint64_t hash = Binary::fnv1a(Binary::FNV_OFFSET_BASIS, packed.data(), packed.size());
+
+            hash ^= mix(catalog.id() ^ (catalog.version() << 20) ^ (static_cast<std::uint64_t>(key) << 40));
+            return mix(hash);
+        }
+
+        /**
+         * @brief splitmix64 finalizer.
+         */
+        static std::uint64_t mix(std::uint64_t value) {
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+            return value ^ (value >> 31);
+        }
+
+        static bool matches(const Entry& entry, const Catalog& catalog, std::size_t key, const FormatArguments& arguments) {
+            return entry.catalog == catalog.id() && entry.version == catalog.version() && entry.key == key
+                && entry.arguments == arguments.packed();
+        }
+
+        void store(Shard& shard, std::uint64_t hash, std::uint64_t generation, const Catalog& catalog, std::size_t key,
+                   const FormatArguments& arguments, const std::string& output) {
+            Entry entry{hash, generation, catalog.id(), catalog.version(), key, arguments.packed(), output};
+            std::lock_guard lock(shard.mutex);
+            auto it = shard.index.find(hash);
+
+            if (it != shard.index.end()) {
+                *it->second = std::move(entry);
+                shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+                return;
+            }
+            shard.entries.push_front(std::move(entry));
+            shard.index[hash] = shard.entries.begin();
+            if (shard.entries.size() > _shardCapacity) {
+                shard.index.erase(shard.entries.back().hash);
+                shard.entries.pop_back();
+                _evictions.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+};
@@ -0,0 +1,365 @@
+/**
+ * @file MessageFormat.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <array>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+/**
+ * @brief Named arguments of a message, e.g. `{"count", 3}`.
+ *
+ * Values are kept as text, packed in a single buffer: arguments are cheap to
+ * build, to hash and to compare, which MessageCache relies on.
+ *
+ * Example usage:
+ * @code
+ * FormatArguments arguments;
+ * arguments.add("name", "Ada").add("count", 3);
+ * @endcode
+ */
+class FormatArguments {
+
+    public:
+
+        /**
+         * @brief Add a text argument.
+         *
+         * @param name Argument name, as written in the message.
+         * @param value Text substituted for `{name}`.
+         * @return FormatArguments& This object, to chain calls.
+         */
+        FormatArguments& add(const std::string& name, const std::string& value) {
+            _packed.append(name);
+            _packed += '\0';
+            _packed.append(value);
+            _packed += '\0';
+            return *this;
+        }
+
+        /**
+         * @brief Add a text argument.
+         *
+         * @param name Argument name, as written in the message.
+         * @param value Null-terminated text substituted for `{name}`.
+         * @return FormatArguments& This object, to chain calls.
+         */
+        FormatArguments& add(const std::string& name, const char* value) {
+            return add(name, std::string(value));
+        }
+
+        /**
+         * @brief Add a number argument, usable by plural arguments.
+         *
+         * @param name Argument name, as written in the message.
+         * @param value Number substituted for `{name}` and `#`.
+         * @return FormatArguments& This object, to chain calls.
+         */
+        FormatArguments& add(const std::string& name, long long value) {
+            return add(name, std::to_string(value));
+        }
+
+        /**
+         * @brief Add a number argument, usable by plural arguments.
+         *
+         * @param name Argument name, as written in the message.
+         * @param value Number substituted for `{name}` and `#`.
+         * @return FormatArguments& This object, to chain calls.
+         */
+        FormatArguments& add(const std::string& name, int value) {
+            return add(name, static_cast<long long>(value));
+        }
+
+        /**
+         * @brief Look up an argument.
+         *
+         * @param name Argument name, not null-terminated.
+         * @param nameSize Length of the name.
+         * @param size Set to the length of the value.
+         * @return const char* Value, nullptr if there is no such argument.
+         */
+        const char* find(const char* name, std::size_t nameSize, std::size_t& size) const {
+            for (std::size_t i = 0; i < _packed.size();) {
+                auto nameEnd = _packed.find('\0', i);
+                auto valueEnd = _packed.find('\0', nameEnd + 1);
+                if (nameEnd - i == nameSize && _packed.compare(i, nameSize, name, nameSize) == 0) {
+                    size = valueEnd - nameEnd - 1;
+                    return _packed.data() + nameEnd + 1;
+                }
+                i = valueEnd + 1;
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Get every argument as one buffer: name, `\0`, value, `\0`, in insertion order.
+         *
+         * @return const std::string& Packed arguments, equal for equal arguments.
+         */
+        const std::string& packed() const {
+            return _packed;
+        }
+
+    private:
+        std::string _packed;
+
+};
+
+/**
+ * @brief Formats ICU-style messages: `{name}`, `{name, number}`, plural and select arguments.
+ *
+ * Supported syntax, the one checked by CatalogValidator:
+ * - `{name}` and `{name, type[, style]}` are replaced by the argument value;
+ * - `{name, select, male {...} other {...}}` picks the arm equal to the value;
+ * - `{name, plural, =0 {...} one {...} other {...}}` picks an exact `=N` arm,
+ *   then the `one` arm if the language puts the number in it, then `other`;
+ *   `#` in the arm is replaced by the number;
+ * - `''` is a quote, a quote before `{`, `}` or `#` starts a literal up to the next quote.
+ *
+ * Plural categories: `one` is n == 1, n == 0 or 1 in French and Portuguese,
+ * never in Chinese, Japanese, Korean, Thai, Vietnamese and Indonesian. Other
+ * CLDR categories (`few`, `many`, ...) fall back to `other`. Unknown arguments
+ * and malformed arguments are copied as written.
+ *
+ * Example usage:
+ * @code
+ * FormatArguments arguments;
+ * arguments.add("count", 3);
+ * MessageFormat::format("{count, plural, one {# new message} other {# new messages}}", arguments, "en");
+ * // "3 new messages"
+ * @endcode
+ */
+class MessageFormat {
+
+    public:
+
+        /**
+         * @brief Format a message.
+         *
+         * @param pattern Message, e.g. from Catalog::text().
+         * @param arguments Named arguments.
+         * @param languageCode Language of the message, selects the plural rule.
+         * @return std::string Formatted message.
+         */
+        static std::string format(const std::string& pattern, const FormatArguments& arguments, const std::string& languageCode) {
+            std::string out;
+            std::size_t i = 0;
+
+            out.reserve(pattern.size() + arguments.packed().size());
+            formatMessage(pattern, i, 0, arguments, pluralRule(languageCode), nullptr, 0, out);
+            return out;
+        }
+
+    private:
+        enum PluralRule { ONE_IS_1, ONE_IS_0_OR_1, NO_ONE };
+
+        static constexpr std::size_t MAX_DEPTH = 16;
+        static constexpr std::array<std::string_view, 2> ONE_INCLUDES_0 = {"fr", "pt"};
+        static constexpr std::array<std::string_view, 6> WITHOUT_ONE = {"zh", "ja", "ko", "th", "vi", "id"};
+
+    private:
+        static PluralRule pluralRule(const std::string& languageCode) {
+            auto language = std::string_view(languageCode).substr(0, languageCode.find_first_of("-_"));
+
+            if (std::ranges::find(ONE_INCLUDES_0, language) != ONE_INCLUDES_0.end())
+                return ONE_IS_0_OR_1;
+            if (std::ranges::find(WITHOUT_ONE, language) != WITHOUT_ONE.end())
+                return NO_ONE;
+            return ONE_IS_1;
+        }
+
+        /**
+         * @brief Append the message from `i` to the end, or to the `}` closing the current arm.
+         *
+         * @param number Value `#` stands for inside a plural arm, nullptr elsewhere.
+         */
+        static void formatMessage(const std::string& m, std::size_t& i, std::size_t depth, const FormatArguments& arguments,
+                                  PluralRule rule, const char* number, std::size_t numberSize, std::string& out) {
+            while (i < m.size()) {
+                auto c = m[i];
+                if (c == '\'') {
+                    if (i + 1 < m.size() && m[i + 1] == '\'') {
+                        out += '\'';
+                        i += 2;
+                        continue;
+                    }
+                    if (i + 1 < m.size() && (m[i + 1] == '{' || m[i + 1] == '}' || (number && m[i + 1] == '#'))) {
+                        auto close = m.find('\'', i + 1);
+                        if (close == std::string::npos)
+                            close = m.size();
+                        out.append(m, i + 1, close - i - 1);
+                        i = close + 1;
+                        continue;
+                    }
+                    out += c;
+                    ++i;
+                } else if (c == '{') {
+                    formatArgument(m, i, depth, arguments, rule, out);
+                } else if (c == '}' && depth > 0) {
+                    return;
+                } else if (c == '#' && number) {
+                    out.append(number, numberSize);
+                    ++i;
+                } else {
+                    auto run = i + 1;
+                    while (run < m.size() && m[run] != '{' && m[run] != '}' && m[run] != '\'' && m[run] != '#')
+                        ++run;
+                    out.append(m, i, run - i);
+                    i = run;
+                }
+            }
+        }
+
+        /**
+         * @brief Append one argument starting at `{`, or copy it as written if it cannot be formatted.
+         */
+        static void formatArgument(const std::string& m, std::size_t& i, std::size_t depth, const FormatArguments& arguments,
+                                   PluralRule rule, std::string& out) {
+            auto start = i++;
+            std::size_t nameBegin;
+            std::size_t nameEnd;
+            std::size_t valueSize = 0;
+
+            skipSpaces(m, i);
+            nameBegin = i;
+            skipIdentifier(m, i);
+            nameEnd = i;
+            skipSpaces(m, i);
+            const auto* value = arguments.find(m.data() + nameBegin, nameEnd - nameBegin, valueSize);
+
+            if (nameBegin == nameEnd || i >= m.size() || depth >= MAX_DEPTH || (m[i] != '}' && m[i] != ',')) {
+                copyArgument(m, start, i, out);
+                return;
+            }
+            if (m[i] == '}') {
+                ++i;
+                if (value)
+                    out.append(value, valueSize);
+                else
+                    out.append(m, start, i - start);
+                return;
+            }
+
+            ++i;
+            skipSpaces(m, i);
+            auto typeBegin = i;
+            skipIdentifier(m, i);
+            std::string_view type(m.data() + typeBegin, i - typeBegin);
+            skipSpaces(m, i);
+            if (type != "plural" && type != "select" && type != "selectordinal") {
+                auto close = m.find('}', i);
+                i = close == std::string::npos ? m.size() : close + 1;
+                if (value)
+                    out.append(value, valueSize);
+                else
+                    out.append(m, start, i - start);
+                return;
+            }
+            if (i >= m.size() || m[i] != ',' || !value) {
+                copyArgument(m, start, i, out);
+                return;
+            }
+            ++i;
+
+            auto plural = type != "select";
+            auto number = plural ? std::strtoll(std::string(value, valueSize).c_str(), nullptr, 10) : 0LL;
+            std::size_t chosen = std::string::npos;     // start of the selected arm, after its '{'
+            std::size_t other = std::string::npos;
+            std::size_t one = std::string::npos;
+
+            for (;;) {
+                skipSpaces(m, i);
+                if (i >= m.size() || m[i] == '}')
+                    break;
+                if (plural && std::string_view(m).substr(i).starts_with("offset:")) {
+                    for (i += 7; i < m.size() && m[i] >= '0' && m[i] <= '9'; ++i) {}
+                    continue;
+                }
+                auto selectorBegin = i;
+                if (m[i] == '=')
+                    ++i;
+                skipIdentifier(m, i);
+                auto selectorEnd = i;
+                skipSpaces(m, i);
+                if (selectorBegin == selectorEnd || i >= m.size() || m[i] != '{') {
+                    copyArgument(m, start, i, out);
+                    return;
+                }
+                auto arm = ++i;
+                skipArm(m, i);
+
+                std::string selector(m, selectorBegin, selectorEnd - selectorBegin);
+                if (chosen != std::string::npos)
+                    continue;
+                if (plural && selector[0] == '=' && std::strtoll(selector.c_str() + 1, nullptr, 10) == number)
+                    chosen = arm;
+                else if (!plural && selector == std::string_view(value, valueSize))
+                    chosen = arm;
+                else if (selector == "one")
+                    one = arm;
+                else if (selector == "other")
+                    other = arm;
+            }
+            if (i < m.size())
+                ++i;
+
+            if (chosen == std::string::npos && plural && one != std::string::npos
+                && ((rule == ONE_IS_1 && number == 1) || (rule == ONE_IS_0_OR_1 && (number == 0 || number == 1))))
+                chosen = one;
+            if (chosen == std::string::npos)
+                chosen = other;
+            if (chosen == std::string::npos)
+                return;
+            formatMessage(m, chosen, depth + 1, arguments, rule, plural ? value : nullptr, plural ? valueSize : 0, out);
+        }
+
+        /**
+         * @brief Move `i` past the `}` closing the arm starting at `i`.
+         */
+        static void skipArm(const std::string& m, std::size_t& i) {
+            std::size_t depth = 1;
+
+            while (i < m.size()) {
+                auto c = m[i++];
+                if (c == '\'' && i < m.size() && m[i] != '\'' && (m[i] == '{' || m[i] == '}' || m[i] == '#')) {
+                    auto close = m.find('\'', i);
+                    i = close == std::string::npos ? m.size() : close + 1;
+                } else if (c == '\'' && i < m.size() && m[i] == '\'') {
+                    ++i;
+                } else if (c == '{') {
+                    ++depth;
+                } else if (c == '}' && --depth == 0) {
+                    return;
+                }
+            }
+        }
+
+        /**
+         * @brief Copy a malformed argument as written, up to its closing brace.
+         */
+        static void copyArgument(const std::string& m, std::size_t start, std::size_t& i, std::string& out) {
+            i = start + 1;
+            skipArm(m, i);
+            out.append(m, start, i - start);
+        }
+
+        static void skipSpaces(const std::string& m, std::size_t& i) {
+            while (i < m.size() && (m[i] == ' ' || m[i] == '\t' || m[i] == '\n' || m[i] == '\r'))
+                ++i;
+        }
+
+        static void skipIdentifier(const std::string& m, std::size_t& i) {
+            while (i < m.size() && ((m[i] >= 'a' && m[i] <= 'z') || (m[i] >= 'A' && m[i] <= 'Z') || (m[i] >= '0' && m[i] <= '9') || m[i] == '_'))
+                ++i;
+        }
+
+};
@@ -0,0 +1,338 @@
+/**
+ * @file TextMetrics.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "Utf8.hpp"
+#include "UnicodeData.hpp"
+
+/**
+ * @brief Layout metadata of a string: sizes, display width and grapheme clusters.
+ *
+ * Measured once (Catalog does it when a string is set), then every query is
+ * O(1), or O(log n) for prefixBytes(). Widths follow the terminal convention:
+ * East Asian Wide and Fullwidth characters and emoji take 2 columns,
+ * combining marks and controls 0, everything else 1. Grapheme clusters follow
+ * UAX #29 for CR LF, combining marks, Hangul syllables, emoji ZWJ sequences
+ * and flags.
+ *
+ * Example usage:
+ * @code
+ * TextMetrics metrics = TextMetrics::measure("Caf\xC3\xA9 \xE6\x9D\xB1\xE4\xBA\xAC"); // "Café 東京"
+ * metrics.width();            // 9 columns
+ * metrics.prefixBytes(7);     // bytes of "Café 東", the longest prefix fitting in 7 columns
+ * @endcode
+ */
+class TextMetrics {
+
+    public:
+
+        /**
+         * @brief Build the metrics of an empty string.
+         */
+        TextMetrics() = default;
+
+        /**
+         * @brief Measure a string.
+         *
+         * @param text Valid UTF-8 string.
+         * @return TextMetrics Metrics of `text`.
+         */
+        static TextMetrics measure(const std::string& text) {
+            TextMetrics metrics;
+            const char* data = text.data();
+
+            metrics._bytes = text.size();
+            if (isPrintableAscii(data, text.size())) {
+                // One byte, one code point, one column per grapheme: no table needed.
+                metrics._codePoints = metrics._width = metrics._graphemes = text.size();
+                return metrics;
+            }
+
+            std::uint32_t previous = 0;
+            std::size_t index = 0;
+            bool emojiSequence = false;             // cluster so far is Extended_Pictographic Extend*
+            std::size_t regionalIndicators = 0;     // consecutive flags letters before `code`
+            while (index < text.size()) {
+                std::size_t start = index;
+                std::uint32_t code = Utf8::decode(data, text.size(), index);
+                ++metrics._codePoints;
+
+                bool boundary = start == 0 || isBoundary(previous, code, emojiSequence, regionalIndicators);
+                unsigned width = codeWidth(code);
+                if (boundary) {
+                    metrics._offsets.push_back(static_cast<std::uint32_t>(start));
+                    metrics._columns.push_back(static_cast<std::uint32_t>(metrics._width));
+                    metrics._width += width;
+                } else if (code == 0xFE0F && metrics._width - metrics._columns.back() == 1 && isPictographic(previous)) {
+                    metrics._width += 1; // emoji presentation selector
+                }
+
+                emojiSequence = isPictographic(code) || (emojiSequence && isExtend(code));
+                regionalIndicators = isRegionalIndicator(code) ? regionalIndicators + 1 : 0;
+                previous = code;
+            }
+            metrics._graphemes = metrics._offsets.size();
+            return metrics;
+        }
+
+        /**
+         * @brief Get the size in bytes.
+         */
+        std::size_t bytes() const {
+            return _bytes;
+        }
+
+        /**
+         * @brief Get the number of code points.
+         */
+        std::size_t codePoints() const {
+            return _codePoints;
+        }
+
+        /**
+         * @brief Get the display width in terminal columns.
+         */
+        std::size_t width() const {
+            return _width;
+        }
+
+        /**
+         * @brief Get the number of grapheme clusters (user-perceived characters).
+         */
+        std::size_t graphemes() const {
+            return _graphemes;
+        }
+
+        /**
+         * @brief Get the byte offset of a grapheme cluster.
+         *
+         * @param index Grapheme index, graphemes() for the end of the string.
+         * @return std::size_t Offset of the first byte of the cluster.
+         */
+        std::size_t graphemeOffset(std::size_t index) const {
+            if (_offsets.empty() || index >= _graphemes)
+                return index >= _graphemes ? _bytes : index;
+            return _offsets[index];
+        }
+
+        /**
+         * @brief Get the column where a grapheme cluster starts.
+         *
+         * @param index Grapheme index, graphemes() for the end of the string.
+         * @return std::size_t Width of the clusters before `index`.
+         */
+        std::size_t graphemeColumn(std::size_t index) const {
+            if (_columns.empty() || index >= _graphemes)
+                return index >= _graphemes ? _width : index;
+            return _columns[index];
+        }
+
+        /**
+         * @brief Get the size of the longest prefix of whole grapheme clusters fitting in a width.
+         *
+         * @param columns Available width.
+         * @return std::size_t Prefix size in bytes, bytes() if the whole string fits.
+         */
+        std::size_t prefixBytes(std::size_t columns) const {
+            if (columns >= _width)
+                return _bytes;
+            return graphemeOffset(prefixGraphemes(columns));
+        }
+
+        /**
+         * @brief Get the number of whole grapheme clusters fitting in a width.
+         *
+         * @param columns Available width.
+         * @return std::size_t Grapheme count.
+         */
+        std::size_t prefixGraphemes(std::size_t columns) const {
+            if (columns >= _width)
+                return _graphemes;
+            if (_columns.empty())
+                return columns;
+            // First cluster ending after `columns`.
+            std::size_t index = 0;
+            std::size_t count = _graphemes;
+            while (count > 0) {
+                std::size_t half = count / 2;
+                if (graphemeColumn(index + half + 1) <= columns) {
+                    index += half + 1;
+                    count -= half + 1;
+                } else {
+                    count = half;
+                }
+            }
+            return index;
+        }
+
+        /**
+         * @brief Get the memory held by the metrics.
+         *
+         * @return std::size_t Bytes of the object and of its cluster tables.
+         */
+        std::size_t memoryBytes() const {
+            return sizeof(TextMetrics) + (_offsets.capacity() + _columns.capacity()) * sizeof(std::uint32_t);
+        }
+
+    private:
+        struct Range {
+            std::uint32_t first;
+            std::uint32_t last;
+        };
+
+    private:
+        std::size_t _bytes = 0;
+        std::size_t _codePoints = 0;
+        std::size_t _width = 0;
+        std::size_t _graphemes = 0;
+        std::vector<std::uint32_t> _offsets; // first byte of each cluster, empty for printable ASCII
+        std::vector<std::uint32_t> _columns; // first column of each cluster, empty for printable ASCII
+
+    private:
+        static bool isPrintableAscii(const char* data, std::size_t size) {
+            for (std::size_t i = 0; i < size; ++i)
+                if (static_cast<unsigned char>(data[i]) < 0x20 || static_cast<unsigned char>(data[i]) >= 0x7F)
+                    return false;
+            return true;
+        }
+
+        static bool inRanges(const Range* ranges, std::size_t count, std::uint32_t code) {
+            auto it = std::upper_bound(ranges, ranges + count, code,
+                [](std::uint32_t value, const Range& range) { return value < range.first; });
+
+            return it != ranges && code <= (it - 1)->last;
+        }
+
+        /**
+         * @brief East Asian Wide (W) and Fullwidth (F) ranges, plus the emoji blocks.
+         */
+        static bool isWide(std::uint32_t code) {
+            static constexpr Range ranges[] = {
+                {0x1100, 0x115F}, {0x231A, 0x231B}, {0x2329, 0x232A}, {0x23E9, 0x23EC}, {0x23F0, 0x23F0},
+                {0x23F3, 0x23F3}, {0x25FD, 0x25FE}, {0x2614, 0x2615}, {0x2648, 0x2653}, {0x267F, 0x267F},
+                {0x2693, 0x2693}, {0x26A1, 0x26A1}, {0x26AA, 0x26AB}, {0x26BD, 0x26BE}, {0x26C4, 0x26C5},
+                {0x26CE, 0x26CE}, {0x26D4, 0x26D4}, {0x26EA, 0x26EA}, {0x26F2, 0x26F3}, {0x26F5, 0x26F5},
+                {0x26FA, 0x26FA}, {0x26FD, 0x26FD}, {0x2705, 0x2705}, {0x270A, 0x270B}, {0x2728, 0x2728},
+                {0x274C, 0x274C}, {0x274E, 0x274E}, {0x2753, 0x2755}, {0x2757, 0x2757}, {0x2795, 0x2797},
+                {0x27B0, 0x27B0}, {0x27BF, 0x27BF}, {0x2B1B, 0x2B1C}, {0x2B50, 0x2B50}, {0x2B55, 0x2B55},
+                {0x2E80, 0x303E}, {0x3041, 0x33FF}, {0x3400, 0x4DBF}, {0x4E00, 0x9FFF}, {0xA000, 0xA4CF},
+                {0xA960, 0xA97F}, {0xAC00, 0xD7A3}, {0xF900, 0xFAFF}, {0xFE10, 0xFE19}, {0xFE30, 0xFE6F},
+                {0xFF00, 0xFF60}, {0xFFE0, 0xFFE6}, {0x16FE0, 0x16FE4}, {0x17000, 0x18CFF}, {0x1B000, 0x1B2FF},
+                {0x1F004, 0x1F004}, {0x1F0CF, 0x1F0CF}, {0x1F18E, 0x1F18E}, {0x1F191, 0x1F19A}, {0x1F1E6, 0x1F1FF},
+                {0x1F200, 0x1F251},
+                {0x1F300, 0x1F320}, {0x1F32D, 0x1F335}, {0x1F337, 0x1F37C}, {0x1F37E, 0x1F393}, {0x1F3A0, 0x1F3CA},
+                {0x1F3CF, 0x1F3D3}, {0x1F3E0, 0x1F3F0}, {0x1F3F4, 0x1F3F4}, {0x1F3F8, 0x1F43E}, {0x1F440, 0x1F440},
+                {0x1F442, 0x1F4FC}, {0x1F4FF, 0x1F53D}, {0x1F54B, 0x1F54E}, {0x1F550, 0x1F567}, {0x1F57A, 0x1F57A},
+                {0x1F595, 0x1F596}, {0x1F5A4, 0x1F5A4}, {0x1F5FB, 0x1F64F}, {0x1F680, 0x1F6C5}, {0x1F6CC, 0x1F6CC},
+                {0x1F6D0, 0x1F6D2}, {0x1F6D5, 0x1F6D7}, {0x1F6EB, 0x1F6EC}, {0x1F6F4, 0x1F6FC}, {0x1F7E0, 0x1F7EB},
+                {0x1F90C, 0x1F93A}, {0x1F93C, 0x1F945}, {0x1F947, 0x1F9FF}, {0x1FA70, 0x1FAFF}, {0x20000, 0x2FFFD},
+                {0x30000, 0x3FFFD}
+            };
+
+            return code >= 0x1100 && inRanges(ranges, sizeof(ranges) / sizeof(ranges[0]), code);
+        }
+
+        /**
+         * @brief Grapheme_Cluster_Break=Extend or SpacingMark: never starts a cluster.
+         */
+        static bool isExtend(std::uint32_t code) {
+            static constexpr Range ranges[] = {
+                {0x0300, 0x036F}, {0x0483, 0x0489}, {0x0591, 0x05BD}, {0x05BF, 0x05BF}, {0x05C1, 0x05C2},
+                {0x05C4, 0x05C5}, {0x05C7, 0x05C7}, {0x0610, 0x061A}, {0x064B, 0x065F}, {0x0670, 0x0670},
+                {0x06D6, 0x06DC}, {0x06DF, 0x06E4}, {0x06E7, 0x06E8}, {0x06EA, 0x06ED}, {0x0900, 0x0903},
+                {0x093A, 0x093C}, {0x093E, 0x094F}, {0x0951, 0x0957}, {0x0962, 0x0963}, {0x0981, 0x0983},
+                {0x09BC, 0x09BC}, {0x09BE, 0x09CD}, {0x0E31, 0x0E31}, {0x0E33, 0x0E3A}, {0x0E47, 0x0E4E},
+                {0x1AB0, 0x1AFF}, {0x1DC0, 0x1DFF}, {0x200C, 0x200D}, {0x20D0, 0x20FF}, {0x302A, 0x302F},
+                {0x3099, 0x309A}, {0xFE00, 0xFE0F}, {0xFE20, 0xFE2F}, {0xFF9E, 0xFF9F}, {0x1F3FB, 0x1F3FF},
+                {0xE0020, 0xE007F}, {0xE0100, 0xE01EF}
+            };
+
+            return code >= 0x0300 && (inRanges(ranges, sizeof(ranges) / sizeof(ranges[0]), code)
+                || UnicodeData::combiningClass(code) != 0);
+        }
+
+        /**
+         * @brief Extended_Pictographic, the emoji that join with ZWJ.
+         */
+        static constexpr bool isPictographic(std::uint32_t code) {
+            return code == 0x00A9 || code == 0x00AE || code == 0x203C || code == 0x2049 || code == 0x2122
+                || (code >= 0x2190 && code <= 0x21FF) || (code >= 0x2300 && code <= 0x23FF)
+                || (code >= 0x2600 && code <= 0x27BF) || (code >= 0x2B00 && code <= 0x2BFF)
+                || (code >= 0x1F000 && code <= 0x1FAFF && !(code >= 0x1F1E6 && code <= 0x1F1FF)
+                    && !(code >= 0x1F3FB && code <= 0x1F3FF));
+        }
+
+        static constexpr bool isRegionalIndicator(std::uint32_t code) {
+            return code >= 0x1F1E6 && code <= 0x1F1FF;
+        }
+
+        static constexpr bool isControl(std::uint32_t code) {
+            return code < 0x20 || (code >= 0x7F && code < 0xA0) || code == 0x2028 || code == 0x2029;
+        }
+
+        /**
+         * @brief Hangul syllable type: 1 = L, 2 = V, 3 = T, 4 = LV, 5 = LVT, 0 = other.
+         */
+        static constexpr int hangulType(std::uint32_t code) {
+            if ((code >= 0x1100 && code <= 0x115F) || (code >= 0xA960 && code <= 0xA97C))
+                return 1;
+            if ((code >= 0x1160 && code <= 0x11A7) || (code >= 0xD7B0 && code <= 0xD7C6))
+                return 2;
+            if ((code >= 0x11A8 && code <= 0x11FF) || (code >= 0xD7CB && code <= 0xD7FB))
+                return 3;
+            if (code >= 0xAC00 && code <= 0xD7A3)
+                return (code - 0xAC00) % 28 == 0 ? 4 : 5;
+            return 0;
+        }
+
+        /**
+         * @brief Width of a code point starting a cluster.
+         */
+        static unsigned codeWidth(std::uint32_t code) {
+            if (code < 0x7F)
+                return code >= 0x20 ? 1 : 0;
+            if (isControl(code) || code == 0x00AD || (code >= 0x200B && code <= 0x200F))
+                return 0;
+            if (isExtend(code) || (code >= 0x1160 && code <= 0x11FF))
+                return 0;
+            return isWide(code) ? 2 : 1;
+        }
+
+        /**
+         * @brief UAX #29 rules GB3 to GB13, GB999 everywhere else.
+         */
+        static bool isBoundary(std::uint32_t previous, std::uint32_t code, bool emojiSequence,
+                               std::size_t regionalIndicators) {
+            if (previous == '\r' && code == '\n')
+                return false;                                                   // GB3
+            if (isControl(previous) || isControl(code))
+                return true;                                                    // GB4, GB5
+            int before = hangulType(previous);
+            int after = hangulType(code);
+            if (before == 1 && after != 0 && after != 3)
+                return false;                                                   // GB6
+            if ((before == 2 || before == 4) && (after == 2 || after == 3))
+                return false;                                                   // GB7
+            if ((before == 3 || before == 5) && after == 3)
+                return false;                                                   // GB8
+            if (isExtend(code))
+                return false;                                                   // GB9, GB9a
+            if (previous == 0x200D && emojiSequence && isPictographic(code))
+                return false;                                                   // GB11
+            if (isRegionalIndicator(code) && regionalIndicators % 2 == 1)
+                return false;                                                   // GB12, GB13
+            return true;                                                        // GB999
+        }
+
+};
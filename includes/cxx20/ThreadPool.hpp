@@ -0,0 +1,311 @@
+/**
+ * @file ThreadPool.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <algorithm>
+#include <exception>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <functional>
+#include <type_traits>
+
+/**
+ * @brief Minimal fixed-size pool of worker threads.
+ *
+ * Tasks are queued in submission order and executed by the first idle worker.
+ * The destructor drains the queue before joining, so every returned future
+ * is eventually satisfied. parallelFor() splits a loop over the workers with
+ * work stealing.
+ *
+ * Example usage:
+ * @code
+ * ThreadPool pool;
+ * std::future<int> answer = pool.submit([] { return 42; });
+ * answer.get();
+ * @endcode
+ */
+class ThreadPool {
+
+    public:
+
+        /**
+         * @brief Start the workers.
+         *
+         * @param workers Number of threads, 0 uses std::thread::hardware_concurrency().
+         */
+        explicit ThreadPool(std::size_t workers = 0) {
+            if (workers == 0)
+                workers = std::thread::hardware_concurrency();
+            if (workers == 0)
+                workers = 1;
+            for (std::size_t i = 0; i < workers; ++i)
+                _workers.emplace_back(&ThreadPool::run, this);
+        }
+
+        /**
+         * @brief delete Copy constructor
+         */
+        ThreadPool(const ThreadPool&) = delete;
+
+        /**
+         * @brief delete Copy assignment
+         */
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Finish the queued tasks and join every worker.
+         */
+        ~ThreadPool() {
+            {
+                std::lock_guard lock(_mutex);
+                _stopping = true;
+            }
+            _wakeUp.notify_all();
+            for (auto& worker : _workers)
+                worker.join();
+        }
+
+        /**
+         * @brief Queue a callable for execution on a worker.
+         *
+         * @tparam F Callable taking no argument.
+         * @param task Work to execute, exceptions are forwarded to the future.
+         * @return std::future holding the result of `task()`.
+         */
+        template<typename F>
+        std::future<std::invoke_result_t<F>> submit(F task) {
+            using Result = std::invoke_result_t<F>;
+
+            // std::function requires a copyable target, packaged_task is move-only.
+            auto job = std::make_shared<std::packaged_task<Result()>>(std::move(task));
+            std::future<Result> result = job->get_future();
+            {
+                std::lock_guard lock(_mutex);
+                _tasks.push_back([job]() { (*job)(); });
+            }
+            _wakeUp.notify_one();
+            return result;
+        }
+
+        /**
+         * @brief Run `body(begin, end)` over [0, count) in chunks of `grain` indexes, on the workers and the calling thread.
+         *
+         * Each participant starts with a contiguous range of chunks and takes
+         * them from the front. Once its range is empty it steals the back half
+         * of another range, so chunks of uneven cost still keep every thread
+         * busy. Returns when every chunk is done.
+         *
+         * Helpers are queued on the pool like any task, but the calling thread
+         * never waits for one that has not started: once no range has chunks
+         * left it only waits for the running helpers, and a helper starting
+         * later returns at once. A loop queued behind slow tasks, or run from
+         * a task of the same pool, completes on the threads that are free.
+         *
+         * Example usage:
+         * @code
+         * pool.parallelFor(values.size(), 1024, [&](std::size_t begin, std::size_t end) {
+         *     for (std::size_t i = begin; i < end; ++i)
+         *         values[i] = compute(i);
+         * });
+         * @endcode
+         *
+         * @tparam F Callable taking `(std::size_t begin, std::size_t end)`.
+         * @param count Number of indexes.
+         * @param grain Indexes per chunk, 0 is treated as 1.
+         * @param body Work on one chunk, the first exception thrown is rethrown once every participant stopped.
+         */
+        template<typename F>
+        void parallelFor(std::size_t count, std::size_t grain, F body) {
+            if (grain == 0)
+                grain = 1;
+            std::size_t chunks = count / grain + (count % grain != 0);
+            while (chunks > MAX_CHUNKS) {
+                grain *= 2;
+                chunks = count / grain + (count % grain != 0);
+            }
+            if (chunks == 0)
+                return;
+
+            std::size_t parts = std::min<std::size_t>(chunks, _workers.size() + 1);
+            auto loop = std::make_shared<ParallelLoop>(parts);
+            for (std::size_t i = 0; i < parts; ++i)
+                loop->ranges[i].bounds.store((static_cast<std::uint64_t>(chunks * i / parts) << 32) | (chunks * (i + 1) / parts));
+
+            for (std::size_t i = 1; i < parts; ++i)
+                submit([loop, i, count, grain, &body]() { help(*loop, i, count, grain, body); });
+
+            std::exception_ptr error;
+            try {
+                runChunks(loop->ranges.get(), parts, 0, count, grain, body);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            std::unique_lock lock(loop->mutex);
+            loop->finished = true;
+            loop->idle.wait(lock, [&] { return loop->running == 0; });
+            if (!error)
+                error = loop->error;
+            lock.unlock();
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+        /**
+         * @brief Get the number of worker threads.
+         *
+         * @return std::size_t Worker count.
+         */
+        std::size_t size() const {
+            return _workers.size();
+        }
+
+    private:
+        /**
+         * @brief Chunks left to a participant of parallelFor(): front << 32 | back, alone on its cache line.
+         */
+        struct StealRange {
+            std::atomic<std::uint64_t> bounds;
+            char padding[64 - sizeof(std::atomic<std::uint64_t>)];
+        };
+
+        /**
+         * @brief State of one parallelFor() call, owned by its helpers too so one starting late can tell the loop is over.
+         */
+        struct ParallelLoop {
+            std::unique_ptr<StealRange[]> ranges;
+            std::size_t parts;
+            std::mutex mutex;
+            std::condition_variable idle;
+            std::size_t running = 0;  // helpers inside runChunks()
+            bool finished = false;    // the calling thread is done, helpers starting now return at once
+            std::exception_ptr error; // first exception thrown by a helper
+
+            explicit ParallelLoop(std::size_t parts) : ranges(std::make_unique<StealRange[]>(parts)), parts(parts) {}
+        };
+
+        static constexpr std::uint64_t MAX_CHUNKS = 0xFFFFFFFFu;
+
+    private:
+        std::mutex _mutex;
+        std::condition_variable _wakeUp;
+        std::deque<std::function<void()>> _tasks;
+        std::vector<std::thread> _workers;
+        bool _stopping = false;
+
+    private:
+        /**
+         * @brief Worker loop: pop and execute tasks until stopped and drained.
+         */
+        void run() {
+            for (;;) {
+                std::function<void()> task;
+                {
+                    std::unique_lock lock(_mutex);
+                    while (!_stopping && _tasks.empty())
+                        _wakeUp.wait(lock);
+                    if (_tasks.empty())
+                        return;
+                    task = std::move(_tasks.front());
+                    _tasks.pop_front();
+                }
+                task();
+            }
+        }
+
+        /**
+         * @brief Body of a parallelFor() helper: run chunks unless the calling thread already finished the loop.
+         */
+        template<typename F>
+        static void help(ParallelLoop& loop, std::size_t self, std::size_t count, std::size_t grain, F& body) {
+            {
+                std::lock_guard lock(loop.mutex);
+                if (loop.finished)
+                    return;
+                ++loop.running;
+            }
+
+            std::exception_ptr error;
+            try {
+                runChunks(loop.ranges.get(), loop.parts, self, count, grain, body);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            std::lock_guard lock(loop.mutex);
+            if (error && !loop.error)
+                loop.error = error;
+            if (--loop.running == 0)
+                loop.idle.notify_all();
+        }
+
+        /**
+         * @brief Run chunks of parallelFor() until no range has any left.
+         */
+        template<typename F>
+        static void runChunks(StealRange* ranges, std::size_t parts, std::size_t self, std::size_t count, std::size_t grain, F& body) {
+            std::uint64_t chunk = 0;
+
+            while (takeFront(ranges[self], chunk) || steal(ranges, parts, self, chunk)) {
+                std::size_t begin = static_cast<std::size_t>(chunk) * grain;
+                body(begin, std::min(count, begin + grain));
+            }
+        }
+
+        /**
+         * @brief Take the first chunk of a range.
+         */
+        static bool takeFront(StealRange& range, std::uint64_t& chunk) {
+            std::uint64_t bounds = range.bounds.load();
+
+            for (;;) {
+                std::uint64_t front = bounds >> 32;
+                std::uint64_t back = bounds & MAX_CHUNKS;
+                if (front >= back)
+                    return false;
+                if (range.bounds.compare_exchange_weak(bounds, ((front + 1) << 32) | back)) {
+                    chunk = front;
+                    return true;
+                }
+            }
+        }
+
+        /**
+         * @brief Move the back half of another participant's range to `self`, and take its first chunk.
+         *
+         * Only called once the range of `self` is empty: no other thread
+         * modifies an empty range, so it is replaced with a plain store.
+         */
+        static bool steal(StealRange* ranges, std::size_t parts, std::size_t self, std::uint64_t& chunk) {
+            for (std::size_t i = 1; i < parts; ++i) {
+                StealRange& victim = ranges[(self + i) % parts];
+                std::uint64_t bounds = victim.bounds.load();
+
+                for (;;) {
+                    std::uint64_t front = bounds >> 32;
+                    std::uint64_t back = bounds & MAX_CHUNKS;
+                    if (front >= back)
+                        break;
+                    std::uint64_t middle = front + (back - front) / 2;
+                    if (victim.bounds.compare_exchange_weak(bounds, (front << 32) | middle)) {
+                        chunk = middle;
+                        ranges[self].bounds.store(((middle + 1) << 32) | back);
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+};
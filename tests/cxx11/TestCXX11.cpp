@@ -10,13 +10,25 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
+#include <algorithm>
 #include <cassert> // Assertion C++11 standard
 #include <cstdlib> // Pour EXIT_FAILURE/EXIT_SUCCESS
+#include <future>
+#include <atomic>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
 
 // En-têtes de la librairie à tester
 #include "I18n.hpp" 
 #include "SupportedLocales.hpp"
 #include "SystemCode.hpp"
+#include "LocaleDE.hpp"
+#include "LocalePT.hpp"
+#include "LocaleCatalog.hpp"
+#include "LocaleMo.hpp"
+#include "LocaleCompressed.hpp"
 
 // --- Utilitaire de Test ---
 
@@ -62,7 +74,7 @@ void test_DefautLocaleEn() {
 
 // Test 3: If no systemLocale & No 'en' take first found (variadic_locales)
 void test_DefaultLocaleFirst() {
-    auto& i18n = I18n<DefaultLocale>::getInstance();
+    I18nContext<DefaultLocale> i18n; // own context: the singleton already holds 'en' from the previous tests
 
     i18n.setSupportedLocales<LocaleEs>(); 
 
@@ -88,6 +100,742 @@ void test_SetupLocaleFr() {
     assert(i18n.getLocale()->getSignUpTitle() == "Inscription" && "T4: Inscription échoué.");
 }
 
+// Test 5: Async loading, setLocale() waits for a locale loaded in background
+void test_AsyncLocaleWait() {
+    auto& i18n = I18n<DefaultLocale>::getInstance();
+
+    i18n.addLocaleLoader<LocaleEs>("es");
+    i18n.addLocaleLoader<LocaleDe>("de");
+    i18n.loadLocalesAsync();
+
+    assert(i18n.setLocale("de") == true && "T5: setLocale('de') doit attendre le chargement.");
+    assert(i18n.getLocale()->getButtonCancel() == "Abbrechen" && "T5: Abbrechen échoué.");
+}
+
+// Test 6: Async loading, Fallback keeps the current locale until the load is done
+void test_AsyncLocaleFallback() {
+    auto& i18n = I18n<DefaultLocale>::getInstance();
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+
+    i18n.addLocaleLoader<LocaleEs>("es");
+    i18n.addLocaleLoader("pt", [opened]() {
+        opened.wait();
+        return std::unique_ptr<DefaultLocale>(new LocalePt());
+    });
+    i18n.loadLocalesAsync(LocaleLoadPolicy::Fallback);
+
+    assert(i18n.isLocaleReady("es") && "T6: La locale prioritaire doit être chargée immédiatement.");
+    assert(!i18n.isLocaleReady("pt") && "T6: 'pt' ne doit pas être prête.");
+    assert(i18n.setLocale("pt") == false && "T6: setLocale('pt') doit échouer sans bloquer.");
+    assert(i18n.getLocale()->languageCode() == "de" && "T6: La locale actuelle doit être conservée.");
+
+    gate.set_value();
+    i18n.waitForLocales();
+
+    assert(i18n.setLocale("pt") == true && "T6: setLocale('pt') a échoué après chargement.");
+    assert(i18n.getLocale()->getButtonCancel() == "Cancelar" && "T6: Cancelar échoué.");
+}
+
+// Test 7: Independent contexts sharing the same locale instances
+void test_ContextSharedLocales() {
+    I18nContext<DefaultLocale> tenantA;
+    I18nContext<DefaultLocale> tenantB;
+
+    tenantA.setSupportedLocales<LocaleEn, LocaleFr>();
+    tenantB.setSupportedLocales<LocaleFr>();
+
+    assert(tenantA.setLocale("fr") && tenantB.setLocale("fr") && "T7: setLocale('fr') a échoué.");
+    assert(tenantA.getLocale() == tenantB.getLocale() && "T7: Les contextes doivent partager 'fr'.");
+    assert(tenantB.setLocale("en") == false && "T7: 'en' n'est pas supportée par le contexte B.");
+
+    I18nContext<DefaultLocale> copy = tenantA;
+    assert(copy.setLocale("en") && "T7: La copie doit supporter 'en'.");
+    assert(tenantA.getLocale()->languageCode() == "fr" && "T7: La copie ne doit pas modifier l'original.");
+    assert(copy.size() == 2 && "T7: La copie doit avoir 2 locales.");
+
+    I18n<DefaultLocale>::getInstance().setLocale("fr");
+    assert(I18n<DefaultLocale>::getInstance().getLocale() == tenantA.getLocale() && "T7: Le singleton doit partager 'fr'.");
+}
+
+// Test 8: Layered catalog, fr-CA overrides a key of fr and shares the others
+void test_LayeredCatalog() {
+    std::shared_ptr<Catalog> fr(new Catalog("fr", defaultCatalogKeys()));
+    fr->set(SignUpTitle, "Inscription");
+    fr->set(SignInTitle, "Connexion");
+    fr->set(LoginSubTitle, "Bienvenue !");
+    fr->set(ButtonSubmit, "Valider");
+    fr->set(ButtonCancel, "Annuler");
+
+    std::shared_ptr<Catalog> frCA(new Catalog("fr-CA", fr));
+    frCA->set("signInTitle", "Ouvrir une session");
+
+    assert(frCA->find(SignUpTitle) == fr->find(SignUpTitle) && "T8: fr-CA doit partager les chaînes de fr.");
+    assert(frCA->overrides(SignInTitle) && !frCA->overrides(SignUpTitle) && "T8: Seule 'signInTitle' est surchargée.");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(frCA);
+
+    assert(context.setLocale("fr-CA") && "T8: setLocale('fr-CA') a échoué.");
+    assert(context.getLocale()->getSignInTitle() == "Ouvrir une session" && "T8: Surcharge échouée.");
+    assert(context.getLocale()->getButtonCancel() == "Annuler" && "T8: Repli sur 'fr' échoué.");
+    assert(context.getCatalog("fr-CA") == frCA && "T8: getCatalog('fr-CA') échoué.");
+
+    std::shared_ptr<Catalog> reloaded(new Catalog(*fr));
+    reloaded->set(SignUpTitle, "S'inscrire");
+    std::shared_ptr<Catalog> layer(new Catalog(*frCA));
+    assert(layer->rebase(reloaded) && "T8: rebase() a échoué.");
+    assert(layer->text(SignUpTitle) == "S'inscrire" && "T8: La clé héritée doit suivre le parent.");
+    assert(layer->text(SignInTitle) == "Ouvrir une session" && "T8: La surcharge doit être conservée.");
+    assert(layer->erase(SignInTitle) && layer->text(SignInTitle) == "Connexion" && "T8: erase() doit revenir au parent.");
+}
+
+// Test 9: Catalog strings are validated as UTF-8 and normalized to NFC
+void test_CatalogUtf8() {
+    std::shared_ptr<Catalog> fr(new Catalog("fr", defaultCatalogKeys()));
+
+    assert(Utf8::validate("Bienvenue \xF0\x9F\x98\x80") && "T9: UTF-8 valide rejeté.");
+    assert(!Utf8::validate("\xED\xA0\x80") && "T9: Surrogate accepté.");
+    assert(!Utf8::validate("\xC0\xAF") && "T9: Forme trop longue acceptée.");
+
+    assert(fr->set(SignInTitle, "Conn\xC3\x28xion") == false && "T9: UTF-8 invalide accepté.");
+    assert(fr->find(SignInTitle) == nullptr && "T9: La clé ne doit pas être définie.");
+    assert(fr->set(ButtonSubmit, "Valide\xCC\x81") && "T9: set() a échoué.");
+    assert(fr->text(ButtonSubmit) == "Valid\xC3\xA9" && "T9: La chaîne doit être en NFC.");
+}
+
+// Test 10: Collation, sort keys follow the alphabet of the language
+void test_Collation() {
+    const Collator& root = Collator::forLanguage("");
+    std::vector<std::string> words;
+    words.push_back("b");
+    words.push_back("\xC3\xA1");   // "á"
+    words.push_back("A");
+    words.push_back("a");
+    root.sort(words);
+    assert(words[0] == "a" && words[1] == "A" && words[2] == "\xC3\xA1" && words[3] == "b" && "T10: Ordre racine incorrect.");
+    assert(root.sortKey("Cote") < root.sortKey("c\xC3\xB4te") && "T10: L'accent doit primer sur la casse.");
+
+    assert(Collator::forLanguage("es-ES").compare("nube", "\xC3\xB1u") < 0 && Collator::forLanguage("es").compare("\xC3\xB1u", "oso") < 0 && "T10: 'ñ' doit être entre 'n' et 'o'.");
+    assert(root.compare("\xC3\xB1u", "nz") < 0 && "T10: 'ñ' est un 'n' accentué à la racine.");
+
+    assert(Collator::forLanguage("sv").compare("zebra", "\xC3\xA5ska") < 0 && "T10: 'å' doit suivre 'z' en suédois.");
+    assert(Collator::forLanguage("sv").compare("\xC3\xA5ska", "\xC3\xA4pple") < 0 && "T10: 'å' doit précéder 'ä' en suédois.");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedLocales<LocaleDe>();
+    assert(context.setLocale("de") && context.getCollator().languageCode() == "de" && "T10: Le collator doit suivre la locale.");
+    assert(&context.getCollator() == &context.getLocale()->collator() && "T10: La locale doit exposer son collator.");
+}
+
+// Test 11: Case mapping and accent folding follow the rules of the language
+void test_CaseMapping() {
+    std::string out;
+    char buffer[8];
+
+    CaseMap::forLanguage("").toLower("STRASSE \xCE\x9F\xCE\x94\xCE\xA5\xCE\xA3\xCE\xA3\xCE\x95\xCE\xA5\xCE\xA3", out); // "ΟΔΥΣΣΕΥΣ"
+    assert(out == "strasse \xCE\xBF\xCE\xB4\xCF\x85\xCF\x83\xCF\x83\xCE\xB5\xCF\x85\xCF\x82" && "T11: Sigma final attendu.");
+    CaseMap::forLanguage("de-DE").toUpper("Stra\xC3\x9F" "e", out);
+    assert(out == "STRASSE" && "T11: 'ß' doit devenir 'SS'.");
+    CaseMap::forLanguage("tr").toUpper("istanbul", out);
+    assert(out == "\xC4\xB0STANBUL" && "T11: 'i' turc doit devenir 'İ'.");
+    CaseMap::forLanguage("tr").toLower("DIYARBAKIR", out);
+    assert(out == "d\xC4\xB1yarbak\xC4\xB1r" && "T11: 'I' turc doit devenir 'ı'.");
+    CaseMap::forLanguage("").fold("Cr\xC3\xA8me Br\xC3\xBBl\xC3\xA9" "e \xC3\x91" "and\xC3\xBA", out);
+    assert(out == "creme brulee nandu" && "T11: Les accents doivent être retirés.");
+    CaseMap::forLanguage("es").fold("\xC3\x91" "and\xC3\xBA", out);
+    assert(out == "\xC3\xB1" "andu" && "T11: 'ñ' doit être conservé en espagnol.");
+
+    std::size_t size = CaseMap::forLanguage("").toUpper("abcd\xC3\xA9\xC3\xA9", 8, buffer, 5);
+    out.assign(buffer, std::min<std::size_t>(size, 4));
+    assert(size == 8 && "T11: La taille complète doit être retournée.");
+    assert(out == "ABCD" && "T11: Seuls les caractères entiers doivent être écrits.");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedLocales<LocaleDe>();
+    assert(context.setLocale("de") && &context.getCaseMap() == &context.getLocale()->caseMap() && "T11: La locale doit exposer son CaseMap.");
+}
+
+// Test 12: Text metrics, display width and grapheme clusters measured when strings are set
+void test_TextMetrics() {
+    std::shared_ptr<Catalog> fr(new Catalog("fr", defaultCatalogKeys()));
+    TextMetrics family = TextMetrics::measure("\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7"); // famille ZWJ
+
+    assert(family.graphemes() == 1 && family.width() == 2 && "T12: La séquence ZWJ doit être un seul graphème.");
+    assert(TextMetrics::measure("Bonjour").width() == 7 && "T12: Largeur ASCII incorrecte.");
+
+    assert(fr->metrics(SignInTitle) == nullptr && "T12: Pas de métadonnées sans chaîne.");
+    fr->set(SignInTitle, "Caf\xC3\xA9 \xE6\x9D\xB1\xE4\xBA\xAC"); // "Café 東京"
+    assert(fr->metrics(SignInTitle) != nullptr && "T12: Les métadonnées doivent suivre la chaîne.");
+    TextMetrics metrics = fr->metrics(SignInTitle) ? *fr->metrics(SignInTitle) : TextMetrics();
+    assert(metrics.bytes() == 12 && metrics.width() == 9 && metrics.graphemes() == 7 && "T12: Les idéogrammes occupent deux colonnes.");
+    assert(metrics.prefixBytes(6) == 6 && metrics.prefixGraphemes(6) == 5 && "T12: Un idéogramme ne doit pas être coupé.");
+    assert(fr->erase(SignInTitle) && fr->metrics(SignInTitle) == nullptr && "T12: Les métadonnées doivent être retirées.");
+}
+
+// Test 13: UTF-16 / UTF-32, transcoded once per locale and shared
+void test_EncodedCatalog() {
+    std::shared_ptr<Catalog> ja(new Catalog("ja", defaultCatalogKeys()));
+    ja->set(SignInTitle, "\xE3\x83\xAD\xE3\x82\xB0\xE3\x82\xA4\xE3\x83\xB3 \xF0\x9F\x94\x91"); // "ログイン 🔑"
+    ja->set(ButtonSubmit, "Submit the registration form now");
+
+    assert(Utf8::toUtf16("Caf\xC3\xA9 \xF0\x9F\x98\x80") == u"Caf\u00E9 \U0001F600" && "T13: Paire de substitution attendue.");
+    assert(Utf8::toUtf32("Caf\xC3\xA9 \xF0\x9F\x98\x80") == U"Caf\u00E9 \U0001F600" && "T13: Conversion UTF-32 incorrecte.");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(ja);
+    context.setLocale("ja");
+    assert(context.getUtf16() != nullptr && context.getUtf16() == context.getUtf16() && "T13: Le cache UTF-16 doit être réutilisé.");
+    assert(context.getUtf16()->text(SignInTitle) == u"\u30ED\u30B0\u30A4\u30F3 \U0001F511" && "T13: Texte UTF-16 incorrect.");
+    assert(context.getUtf16()->length(SignInTitle) == 7 && "T13: '🔑' doit occuper deux unités UTF-16.");
+    assert(context.getUtf16()->text(ButtonSubmit) == u"Submit the registration form now" && "T13: Chemin ASCII incorrect.");
+    assert(context.getUtf16()->length(SignUpTitle) == 0 && context.getUtf16()->data(SignUpTitle)[0] == u'\0' && "T13: Une clé manquante doit être vide.");
+    assert(context.getUtf32() != nullptr && context.getUtf32()->length(SignInTitle) == 6 && "T13: Texte UTF-32 incorrect.");
+
+    I18nContext<DefaultLocale> english;
+    english.setSupportedLocales<LocaleEn>();
+    assert(english.getUtf16() == nullptr && "T13: Une locale sans catalogue n'a pas de cache.");
+}
+
+// Test 14: Catalog export, streamed JSON / binary and content hash
+void test_CatalogExport() {
+    std::shared_ptr<Catalog> fr(new Catalog("fr", defaultCatalogKeys()));
+    fr->set(SignInTitle, "Connexion");
+    fr->set(LoginSubTitle, "Dites \"bonjour\"\n\x01");
+    fr->set(ButtonSubmit, "Valider");
+
+    std::ostringstream json;
+    CatalogExporter(fr).write(json, ExportFormat::Json);
+    assert(json.str() == "{\"signInTitle\":\"Connexion\",\"loginSubTitle\":\"Dites \\\"bonjour\\\"\\n\\u0001\",\"buttonSubmit\":\"Valider\"}" && "T14: JSON incorrect.");
+
+    std::vector<std::string> names;
+    names.push_back("buttonSubmit");
+    names.push_back("unknownKey");
+    names.push_back("signUpTitle");
+    CatalogExporter subset(fr, names);
+    std::ostringstream binary;
+    subset.write(binary, ExportFormat::Binary);
+    assert(subset.keys().size() == 2 && "T14: Les clés inconnues doivent être ignorées.");
+    assert(binary.str().compare(0, 5, "I18N\x01") == 0 && "T14: En-tête binaire incorrect.");
+    assert(binary.str().compare(13, binary.str().size() - 13, "\x02" "fr" "\x01" "\x0C" "buttonSubmit" "\x07" "Valider") == 0 && "T14: Entrées binaires incorrectes.");
+    assert(subset.etag().size() == 18 && subset.etag()[0] == '"' && "T14: ETag mal formé.");
+
+    std::shared_ptr<Catalog> copy(new Catalog(*fr));
+    assert(CatalogExporter(copy).hash() == CatalogExporter(fr).hash() && "T14: Le hash doit être stable.");
+    copy->set(ButtonSubmit, "Envoyer");
+    assert(CatalogExporter(copy).hash() != CatalogExporter(fr).hash() && "T14: Le hash doit suivre le contenu.");
+    assert(CatalogExporter(copy, names).hash() != subset.hash() && "T14: Le hash du sous-ensemble doit changer.");
+    names.pop_back();
+    assert(CatalogExporter(fr, names).hash() == subset.hash() && "T14: Une clé manquante ne change pas le hash.");
+
+    LocaleCatalog locale(fr);
+    assert(locale.contentHash() == CatalogExporter(fr).hash() && "T14: Hash de la locale incorrect.");
+}
+
+// Test 15: Catalog delta, new snapshot sharing the unchanged strings
+void test_CatalogDelta() {
+    std::shared_ptr<Catalog> fr(new Catalog("fr", defaultCatalogKeys()));
+    fr->set(SignUpTitle, "Inscription");
+    fr->set(SignInTitle, "Connexion");
+    fr->set(ButtonCancel, "Annuler");
+    fr->setVersion(41);
+    std::shared_ptr<Catalog> frCA(new Catalog("fr-CA", fr));
+    frCA->set(SignUpTitle, "S'inscrire");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    context.setSupportedCatalog<LocaleCatalog>(frCA);
+    context.setLocale("fr");
+
+    CatalogDelta delta("fr", 41, 42);
+    delta.set("signInTitle", "Se connecter");
+    delta.set("buttonSubmit", "Valider");
+    delta.remove("buttonCancel");
+
+    std::stringstream wire;
+    delta.write(wire);
+    std::shared_ptr<CatalogDelta> parsed = CatalogDelta::read(wire);
+    assert(parsed && parsed->changes().size() == 3 && parsed->version() == 42 && "T15: Lecture du delta échouée.");
+    assert(!CatalogDelta(fr->languageCode(), 40, 41).apply(*fr) && "T15: Une version différente doit être refusée.");
+
+    bool applied = parsed && context.applyDelta<LocaleCatalog>(*parsed);
+    assert(applied && context.getCatalog("fr")->version() == 42 && "T15: applyDelta() a échoué.");
+    assert(context.getLocale()->getSignInTitle() == "Se connecter" && context.getLocale()->getButtonSubmit() == "Valider" && "T15: Modification non visible.");
+    assert(context.getLocale()->getButtonCancel().empty() && "T15: La clé doit être supprimée.");
+    assert(context.getCatalog("fr")->entry(SignUpTitle) == fr->entry(SignUpTitle) && "T15: Les chaînes inchangées doivent être partagées.");
+    assert(fr->text(SignInTitle) == "Connexion" && fr->version() == 41 && "T15: L'ancien catalogue ne doit pas changer.");
+    assert(context.getHandle("fr-CA")->getSignInTitle() == "Se connecter" && context.getHandle("fr-CA")->getSignUpTitle() == "S'inscrire" && "T15: La couche fr-CA doit suivre le delta.");
+    assert(!context.applyDelta<LocaleCatalog>(delta) && "T15: Un delta ne s'applique qu'une fois.");
+    (void)applied;
+}
+
+// Test 16: Cross-locale validation of the registered catalogs
+void test_ValidateCatalogs() {
+    std::shared_ptr<Catalog> en(new Catalog("en", defaultCatalogKeys()));
+    en->set(SignUpTitle, "Sign up");
+    en->set(SignInTitle, "Welcome back, {name}");
+    en->set(LoginSubTitle, "{count, plural, one {# new message} other {# new messages}}");
+    std::shared_ptr<Catalog> fr(new Catalog("fr", defaultCatalogKeys()));
+    fr->set(SignInTitle, "Bon retour, {nom}");
+    fr->set(LoginSubTitle, "{count, plural, one {# nouveau message} other {# nouveaux messages}");
+    fr->set(ButtonSubmit, "Valider");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(en);
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    ThreadPool pool(2);
+    std::vector<ValidationIssue> issues = context.validateCatalogs("en", pool);
+
+    assert(issues.size() == 4 && "T16: Quatre problèmes attendus.");
+    assert(issues[0].error == ValidationError::ExtraKey && issues[0].key == "buttonSubmit" && "T16: Clé en trop non détectée.");
+    assert(issues[1].error == ValidationError::InvalidSyntax && issues[1].key == "loginSubTitle" && "T16: Accolade manquante non détectée.");
+    assert(issues[2].error == ValidationError::PlaceholderMismatch && issues[2].key == "signInTitle" && "T16: Paramètre différent non détecté.");
+    assert(issues[3].error == ValidationError::MissingKey && issues[3].key == "signUpTitle" && "T16: Clé manquante non détectée.");
+    assert(context.validateCatalogs("en").size() == issues.size() && "T16: La validation séquentielle doit donner le même résultat.");
+    std::vector<ValidationIssue> missing = context.validateCatalogs("de", pool);
+    assert(missing.size() == 1 && missing[0].error == ValidationError::MissingReference && missing[0].languageCode == "de" && "T16: La référence doit être enregistrée.");
+    (void)missing;
+
+    std::string signature;
+    std::string error;
+    assert(CatalogValidator::parse("{n, select, a {{x}} other {'{'}} {x}", signature, error) && signature == "n:select,x" && "T16: Signature incorrecte.");
+    assert(!CatalogValidator::parse("{n, plural, one {#}}", signature, error) && "T16: Le bras 'other' est obligatoire.");
+}
+
+// Test 17: Message cache, formatted messages memoized per catalog, key and arguments
+void test_MessageCache() {
+    std::shared_ptr<Catalog> en(new Catalog("en", defaultCatalogKeys()));
+    en->set(LoginSubTitle, "{count, plural, one {# new message} other {# new messages}}");
+    std::shared_ptr<Catalog> fr(new Catalog("fr", defaultCatalogKeys()));
+    fr->set(LoginSubTitle, "{count, plural, one {# nouveau message} other {# nouveaux messages}}");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(en);
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    context.setLocale("en");
+    context.enableMessageCache(2);
+
+    FormatArguments one;
+    one.add("count", 1);
+    FormatArguments three;
+    three.add("count", 3);
+    assert(context.format(LoginSubTitle, one) == "1 new message" && "T17: Pluriel 'one' incorrect.");
+    assert(context.format(LoginSubTitle, three) == "3 new messages" && "T17: Pluriel 'other' incorrect.");
+    assert(context.format(LoginSubTitle, three) == "3 new messages" && "T17: Sortie en cache incorrecte.");
+    assert(context.getMessageCache()->stats().hits == 1 && context.getMessageCache()->stats().misses == 2 && "T17: Un appel répété doit être servi par le cache.");
+
+    context.setLocale("fr");
+    FormatArguments zero;
+    zero.add("count", 0);
+    assert(context.format(LoginSubTitle, zero) == "0 nouveau message" && "T17: Règle de pluriel du français incorrecte.");
+    assert(context.format(LoginSubTitle, three) == "3 nouveaux messages" && "T17: Changement de langue non pris en compte.");
+
+    CatalogDelta delta("fr", 0, 1);
+    delta.set("loginSubTitle", "{count, plural, one {# message} other {# messages}}");
+    context.applyDelta<LocaleCatalog>(delta);
+    assert(context.format(LoginSubTitle, three) == "3 messages" && "T17: Un catalogue rechargé ne doit pas réutiliser les entrées de l'ancien.");
+
+    MessageCacheStats stats = context.getMessageCache()->stats();
+    assert(stats.hits == 1 && stats.misses == 5 && stats.size <= context.getMessageCache()->capacity() && "T17: Statistiques incorrectes.");
+    assert(stats.hitRate() > 0.16 && stats.hitRate() < 0.17 && "T17: Taux de succès incorrect.");
+    assert(context.format(ButtonSubmit + 100, one).empty() && "T17: Clé hors limites.");
+
+    I18nContext<DefaultLocale> copy(context);
+    copy.setLocale("en");
+    assert(copy.format(LoginSubTitle, three) == "3 new messages" && context.format(LoginSubTitle, three) == "3 messages" && "T17: Copie de contexte incorrecte.");
+    stats = context.getMessageCache()->stats();
+    assert(stats.hits == 3 && stats.misses == 5 && "T17: Le changement de langue d'une copie ne doit pas vider le cache des autres.");
+    Catalog reloaded(*fr);
+    assert(reloaded.id() != fr->id() && "T17: Une copie de catalogue doit avoir son propre identifiant.");
+    (void)stats;
+}
+
+std::vector<std::pair<std::string, std::string>> polishMoEntries() {
+    std::vector<std::pair<std::string, std::string>> entries;
+    entries.push_back(std::make_pair(std::string(), std::string("Language: pl\nPlural-Forms: nplurals=3; plural=(n==1 ? 0 : n%10>=2 && n%10<=4 && (n%100<10 || n%100>=20) ? 1 : 2);\n")));
+    entries.push_back(std::make_pair(std::string("Sign up"), std::string("Zarejestruj się")));
+    entries.push_back(std::make_pair(std::string("Cancel"), std::string("Anuluj")));
+    entries.push_back(std::make_pair(std::string("file\0files", 10), std::string("plik\0pliki\0plików", 18)));
+    return entries;
+}
+
+// Test 18: Gettext .mo, strings looked up through the embedded hash table
+void test_MoFile() {
+    for (int bigEndian = 0; bigEndian < 2; ++bigEndian) {
+        bool written = writeMoFile("test_pl.mo", polishMoEntries(), bigEndian == 1);
+        std::shared_ptr<const MoFile> file = MoFile::open("test_pl.mo");
+
+        assert(written && file && file->languageCode() == "pl" && file->pluralCount() == 3 && "T18: Lecture du fichier .mo échouée.");
+        assert(file->text("Cancel") == "Anuluj" && file->text("Missing") == "Missing" && "T18: Recherche par table de hachage incorrecte.");
+        assert(file->text("file", "files", 1) == "plik" && file->text("file", "files", 3) == "pliki" && "T18: Formes plurielles incorrectes.");
+        assert(file->text("file", "files", 5) == "plików" && file->text("file", "files", 22) == "pliki" && "T18: Expression Plural-Forms incorrecte.");
+        (void)written;
+    }
+
+    I18nContext<DefaultLocale> context;
+    bool registered = context.setSupportedMoFile<LocaleMo>("test_pl.mo") && context.setLocale("pl");
+    assert(registered && "T18: Enregistrement de la locale échoué.");
+    assert(context.getLocale()->getSignUpTitle() == "Zarejestruj się" && context.getLocale()->getSignInTitle() == "Sign in" && "T18: Locale .mo incorrecte.");
+
+    bool written = writeMoFile("test_pl.mo", polishMoEntries(), false, false);
+    assert(written && MoFile::open("test_pl.mo")->text("Sign up") == "Zarejestruj się" && "T18: Recherche sans table de hachage échouée.");
+    std::ofstream("test_pl.mo", std::ios::binary) << "not a mo file, too short";
+    assert(!MoFile::open("test_pl.mo") && !context.setSupportedMoFile<LocaleMo>("missing.mo") && "T18: Un fichier invalide doit être refusé.");
+
+    std::string chain("n");
+    for (int k = 0; k < 100000; ++k)
+        chain += "+n";
+    PluralExpression sum;
+    assert(sum.parse("n+n+n") && !sum.parse(chain) && sum.evaluate(2) == 6 && "T18: Une chaîne trop longue doit être refusée.");
+    std::vector<std::pair<std::string, std::string>> deep = polishMoEntries();
+    deep[0].second = "Language: pl\nPlural-Forms: nplurals=3; plural=" + chain + ";\n";
+    written = writeMoFile("test_pl.mo", deep, false);
+    assert(written && !MoFile::open("test_pl.mo") && "T18: Un Plural-Forms trop profond doit être refusé.");
+    std::remove("test_pl.mo");
+    (void)registered;
+    (void)written;
+}
+
+// Test 19: Memory report, footprint per locale and per key
+void test_MemoryReport() {
+    std::size_t liveBefore = ILocale::liveCount();
+    {
+        std::shared_ptr<Catalog> fr(new Catalog("fr", defaultCatalogKeys()));
+        fr->set(SignUpTitle, "Inscription à la plateforme de démonstration");
+        fr->set(SignInTitle, "Connexion");
+        std::shared_ptr<Catalog> frCA(new Catalog("fr-CA", std::shared_ptr<const Catalog>(fr)));
+        frCA->set(SignInTitle, "Ouvrir une session sur la plateforme");
+
+        I18nContext<DefaultLocale> context;
+        context.setSupportedCatalog<LocaleCatalog>(frCA);
+        context.setSupportedCatalog<LocaleCatalog>(fr);
+        bool written = writeMoFile("test_pl.mo", polishMoEntries(), false);
+        bool registered = written && context.setSupportedMoFile<LocaleMo>("test_pl.mo");
+        MemoryReport report = context.memoryReport();
+
+        assert(registered && report.locales.size() == 3 && report.locales[0].languageCode == "fr" && report.locales[1].languageCode == "fr-CA" && "T19: Une entrée par locale, triées par code.");
+        assert(report.liveLocales == liveBefore + 3 && "T19: Nombre de locales vivantes incorrect.");
+        assert(report.locales[0].strings == 2 && report.locales[0].sharedBytes == 0 && report.locales[0].heapBytes > 0 && "T19: Empreinte de 'fr' incorrecte.");
+        assert(report.locales[1].sharedBytes > 0 && report.locales[1].sharedBytes == report.locales[1].internedSavings && "T19: La chaîne héritée doit être comptée comme partagée.");
+        assert(report.locales[2].mappedBytes > 0 && report.mappedBytes() == report.locales[2].mappedBytes && "T19: Le fichier .mo doit être compté comme projeté.");
+        assert(report.keys.size() == defaultCatalogKeys()->size() && report.keys[SignUpTitle].locales == 2 && report.keys[SignUpTitle].bytes == report.locales[1].sharedBytes && "T19: Empreinte par clé incorrecte.");
+        assert(report.keys[ButtonCancel].bytes == 0 && report.heapBytes() > report.keys[SignUpTitle].bytes + report.keys[SignInTitle].bytes && "T19: Total incorrect.");
+        std::remove("test_pl.mo");
+        (void)registered;
+    }
+    assert(ILocale::liveCount() == liveBefore && "T19: Les locales détruites ne doivent plus être comptées.");
+    (void)liveBefore;
+}
+
+// Test 20: Locale propagated through scopes and across executor hops
+void test_LocalePropagation() {
+    I18nContext<DefaultLocale> tenant;
+    tenant.setSupportedLocales<LocaleEn, LocaleFr, LocaleEs, LocaleDe, LocalePt>();
+    const char* codes[] = {"en", "fr", "es", "de", "pt"};
+    DefaultLocale* selected = tenant.getLocale();
+
+    assert(!tenant.getHandle("it") && LocaleHandle<DefaultLocale>::current().get() == nullptr && "T20: Handle vide attendu.");
+    {
+        LocaleScope<DefaultLocale> outer(tenant.getHandle("fr"));
+        {
+            LocaleScope<DefaultLocale> inner(tenant.getHandle("de"));
+            assert(LocaleHandle<DefaultLocale>::current()->languageCode() == "de" && "T20: Le scope interne doit primer.");
+        }
+        assert(LocaleHandle<DefaultLocale>::current()->languageCode() == "fr" && "T20: Le scope externe doit être restauré.");
+        assert(tenant.getLocale() == selected && "T20: Un scope ne doit pas changer la sélection du contexte.");
+    }
+    assert(!LocaleHandle<DefaultLocale>::current() && "T20: Aucun locale courant après les scopes.");
+
+    ThreadPool pool(4);
+    std::vector<std::future<std::string>> results;
+    for (std::size_t i = 0; i < 1000; ++i) {
+        results.push_back(pool.submit(bindLocale(tenant.getHandle(codes[i % 5]), []() {
+            return LocaleHandle<DefaultLocale>::current()->languageCode();
+        })));
+    }
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < results.size(); ++i)
+        mismatches += results[i].get() == codes[i % 5] ? 0 : 1;
+    std::future<bool> cleared = pool.submit([]() { return !LocaleHandle<DefaultLocale>::current(); });
+    bool workerCleared = cleared.get();
+
+    assert(mismatches == 0 && "T20: Chaque tâche doit voir le locale de sa requête.");
+    assert(workerCleared && "T20: Le locale du worker doit être restauré après la tâche.");
+    (void)selected;
+    (void)mismatches;
+    (void)workerCleared;
+}
+
+// Test 21: Compressed catalog, blocks decompressed on demand with a shared dictionary
+void test_CompressedCatalog() {
+    Catalog en("en", defaultCatalogKeys());
+    en.set(SignUpTitle, "Sign up to the demonstration platform");
+    en.set(SignInTitle, "Sign in to the demonstration platform");
+    en.set(LoginSubTitle, "Sign in to continue");
+    en.set(ButtonSubmit, "Submit");
+    en.set(ButtonCancel, "Cancel");
+    Catalog fr("fr", defaultCatalogKeys());
+    fr.set(SignUpTitle, "Inscription à la plateforme");
+    fr.set(SignInTitle, "Connexion à la plateforme");
+    fr.set(LoginSubTitle, "Connectez-vous pour continuer");
+    fr.set(ButtonSubmit, "Valider");
+
+    std::vector<std::string> samples;
+    for (std::size_t key = 0; key < en.size(); ++key) {
+        samples.push_back(en.text(key));
+        samples.push_back(fr.text(key));
+    }
+    std::shared_ptr<const CompressionDictionary> dictionary = CompressionDictionary::train(samples);
+    std::shared_ptr<const CompressedCatalog> compressedFr(new CompressedCatalog(fr, dictionary, 32, 1));
+    std::shared_ptr<const CompressedCatalog> compressedEn(new CompressedCatalog(en, dictionary, 32, 1));
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCompressedCatalog<LocaleCompressed>(compressedEn);
+    context.setSupportedCompressedCatalog<LocaleCompressed>(compressedFr);
+    bool selected = context.setLocale("fr");
+    assert(selected && compressedFr->blockCount() == 2 && compressedFr->stats().misses == 0 && "T21: Rien ne doit être décompressé à l'enregistrement.");
+
+    std::string signIn = context.getLocale()->getSignInTitle();
+    std::string signUp = context.getLocale()->getSignUpTitle();
+    assert(signIn == "Connexion à la plateforme" && signUp == "Inscription à la plateforme" && "T21: Texte décompressé incorrect.");
+    assert(compressedFr->stats().misses == 1 && compressedFr->stats().hits == 1 && "T21: Le bloc doit être décompressé une seule fois.");
+    std::string submit = context.getLocale()->getButtonSubmit();
+    std::string cancel = context.getLocale()->getButtonCancel();
+    CompressedCatalogStats stats = compressedFr->stats();
+    assert(submit == "Valider" && cancel.empty() && "T21: Clé du second bloc ou clé manquante incorrecte.");
+    assert(stats.misses == 2 && stats.evictions == 1 && stats.residentBlocks == 1 && "T21: Le cache doit rester borné à un bloc.");
+
+    std::stringstream stream;
+    compressedFr->write(stream);
+    std::shared_ptr<const CompressedCatalog> parsed = CompressedCatalog::read(stream, dictionary);
+    assert(parsed && parsed->languageCode() == "fr" && parsed->text(LoginSubTitle) == "Connectez-vous pour continuer" && !parsed->contains(ButtonCancel) && "T21: Relecture du format binaire incorrecte.");
+    std::stringstream other;
+    compressedFr->write(other);
+    std::vector<std::string> otherSamples(1, "Un autre dictionnaire");
+    assert(!CompressedCatalog::read(other, CompressionDictionary::train(otherSamples)) && "T21: Un autre dictionnaire doit être refusé.");
+    std::stringstream corrupted;
+    compressedFr->write(corrupted);
+    std::stringstream truncated(corrupted.str().substr(0, 18) + "\x01\xFF\xFF\xFF\xFF\x0F" + "abc"); // first block claims 4 GiB
+    assert(!CompressedCatalog::read(truncated, dictionary) && "T21: Un bloc tronqué doit être refusé.");
+
+    MemoryReport report = context.memoryReport();
+    assert(report.locales.size() == 2 && report.locales[1].strings == 4 && report.locales[0].sharedBytes == 0 && "T21: Empreinte incorrecte.");
+    assert(report.locales[1].sharedBytes >= dictionary->memoryBytes() && report.locales[0].heapBytes > report.locales[1].sharedBytes && "T21: Le dictionnaire doit être compté une fois.");
+    (void)selected;
+    (void)stats;
+}
+
+// Test 22: Translation variants, sparse layers selected per request
+void test_Variants() {
+    std::shared_ptr<Catalog> fr(new Catalog("fr", defaultCatalogKeys()));
+    fr->set(SignUpTitle, "Inscription");
+    fr->set(SignInTitle, "Connexion");
+    std::shared_ptr<Catalog> en(new Catalog("en", defaultCatalogKeys()));
+    en->set(SignInTitle, "Sign in");
+    std::shared_ptr<Catalog> shortCopy(new Catalog("fr", fr));
+    shortCopy->set(SignUpTitle, "Créer un compte");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    context.setSupportedCatalog<LocaleCatalog>(en);
+    bool rejected = !context.setSupportedVariant<LocaleCatalog>(0, shortCopy) && !context.setSupportedVariant<LocaleCatalog>(1, nullptr);
+    bool rootRejected = !context.setSupportedVariant<LocaleCatalog>(1, std::make_shared<Catalog>("fr", defaultCatalogKeys()));
+    bool orphanRejected = !context.setSupportedVariant<LocaleCatalog>(1, std::make_shared<Catalog>("de", en));
+    assert(rootRejected && orphanRejected && "T22: Une variante doit être une couche sur le catalogue de sa locale.");
+    bool registered = context.setSupportedVariant<LocaleCatalog>(1, shortCopy);
+    assert(rejected && registered && context.size() == 2 && "T22: Enregistrement de la variante incorrect.");
+
+    LocaleHandle<DefaultLocale> variant = context.getHandle("fr", 1);
+    assert(variant && variant != context.getHandle("fr") && "T22: La variante doit être une locale distincte.");
+    assert(variant->getSignUpTitle() == "Créer un compte" && variant->getSignInTitle() == "Connexion" && "T22: Surcharge ou repli incorrect.");
+    assert(context.getHandle("fr", 2) == context.getHandle("fr") && context.getHandle("en", 1) == context.getHandle("en") && "T22: Une variante absente doit retomber sur la locale.");
+    assert(!context.getHandle("de", 1) && "T22: Langue inconnue.");
+
+    bool selected = context.setLocale("fr", 1);
+    assert(selected && context.getLocale() == variant.get() && "T22: setLocale(code, variante) incorrect.");
+    bool unknown = context.setLocale("de", 1);
+    assert(!unknown && context.getLocale() == variant.get() && "T22: Une langue inconnue ne change pas la sélection.");
+
+    CatalogDelta delta("fr", 0, 1);
+    delta.set("signInTitle", "Se connecter");
+    bool applied = context.applyDelta<LocaleCatalog>(delta);
+    const DefaultLocale* rebased = context.getHandle("fr", 1).get();
+    assert(applied && rebased != variant.get() && context.getLocale() == rebased && "T22: La variante doit suivre le nouveau catalogue.");
+    assert(rebased->getSignInTitle() == "Se connecter" && rebased->getSignUpTitle() == "Créer un compte" && "T22: Surcharge perdue au rebase.");
+    bool staleRejected = !context.setSupportedVariant<LocaleCatalog>(2, shortCopy);
+    assert(staleRejected && "T22: Une couche sur l'ancien catalogue doit être refusée.");
+
+    MemoryReport report = context.memoryReport();
+    assert(report.locales.size() == 3 && report.locales[2].languageCode == "fr#1" && "T22: La variante doit suivre sa locale dans le rapport.");
+    assert(report.locales[2].strings == 2 && report.locales[2].sharedBytes > 0 && "T22: Les chaînes héritées doivent être partagées.");
+    (void)variant;
+    (void)rejected;
+    (void)rootRejected;
+    (void)orphanRejected;
+    (void)staleRejected;
+    (void)registered;
+    (void)selected;
+    (void)unknown;
+    (void)applied;
+    (void)rebased;
+}
+
+// Test 23: A loader returning nullptr leaves its locale unregistered
+void test_NullLoader() {
+    I18nContext<DefaultLocale> context;
+
+    context.addLocaleLoader("en", []() { return std::shared_ptr<DefaultLocale>(); });
+    context.addLocaleLoader<LocaleEs>("es");
+    context.addLocaleLoader("de", []() { return std::shared_ptr<DefaultLocale>(); });
+    context.loadLocalesAsync();
+
+    bool en = context.setLocale("en");
+    bool de = context.setLocale("de");
+    assert(!en && !de && "T23: Une locale nulle ne doit pas être sélectionnable.");
+    context.waitForLocales();
+    assert(context.size() == 1 && context.getLocale() && context.getLocale()->languageCode() == "es" && "T23: Seule 'es' doit être enregistrée.");
+    (void)en;
+    (void)de;
+}
+
+// Test 24: Layers registered over a catalog follow it when a delta replaces it
+void test_LayerFollowsDelta() {
+    std::shared_ptr<Catalog> fr(new Catalog("fr", defaultCatalogKeys()));
+    fr->set(SignUpTitle, "Inscription");
+    fr->set(SignInTitle, "Connexion");
+    std::shared_ptr<Catalog> frCA(new Catalog("fr-CA", fr));
+    frCA->set(SignInTitle, "Ouvrir une session");
+    std::shared_ptr<Catalog> frQC(new Catalog("fr-QC", frCA));
+    frQC->set(ButtonCancel, "Annuler");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    context.setSupportedCatalog<LocaleCatalog>(frCA);
+    context.setSupportedCatalog<LocaleCatalog>(frQC);
+    bool selected = context.setLocale("fr-QC");
+
+    CatalogDelta delta("fr", 0, 1);
+    delta.set("signUpTitle", "Créer un compte");
+    bool applied = context.applyDelta<LocaleCatalog>(delta);
+    assert(selected && applied && "T24: applyDelta() a échoué.");
+    assert(context.getCatalog("fr-CA")->parent() == context.getCatalog("fr") && "T24: fr-CA doit être rebasée sur le nouveau fr.");
+    assert(context.getCatalog("fr-QC")->parent() == context.getCatalog("fr-CA") && "T24: fr-QC doit être rebasée sur le nouveau fr-CA.");
+    assert(context.getHandle("fr-CA")->getSignUpTitle() == "Créer un compte" && "T24: fr-CA doit suivre le delta.");
+    assert(context.getHandle("fr-CA")->getSignInTitle() == "Ouvrir une session" && "T24: Surcharge de fr-CA perdue.");
+    assert(context.getLocale() == context.getHandle("fr-QC").get() && "T24: La sélection doit suivre fr-QC.");
+    assert(context.getLocale()->getSignUpTitle() == "Créer un compte" && context.getLocale()->getButtonCancel() == "Annuler" && "T24: fr-QC doit suivre le delta.");
+    (void)selected;
+    (void)applied;
+}
+
+// Test 25: parallelFor() called from a task of its own pool does not wait for its queued helpers
+void test_NestedParallelFor() {
+    ThreadPool pool(1);
+    std::future<std::size_t> total = pool.submit([&pool]() {
+        std::atomic<std::size_t> sum(0);
+        pool.parallelFor(1000, 10, [&sum](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+                sum += i;
+        });
+        return sum.load();
+    });
+    std::size_t sum = total.get();
+
+    assert(sum == 999 * 1000 / 2 && "T25: Tous les indices doivent être traités.");
+    (void)sum;
+}
+
+// Test 26: A locale registered without a catalog replaces the catalog and the variants of its code
+void test_CatalogReplacedByLocale() {
+    std::shared_ptr<Catalog> fr(new Catalog("fr", defaultCatalogKeys()));
+    fr->set(SignInTitle, "Connexion");
+    std::shared_ptr<Catalog> shortCopy(new Catalog("fr", fr));
+    shortCopy->set(SignInTitle, "Se connecter");
+    std::shared_ptr<Catalog> en(new Catalog("en", defaultCatalogKeys()));
+    en->set(SignInTitle, "Sign in");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(en);
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    bool registered = context.setSupportedVariant<LocaleCatalog>(1, shortCopy) && context.setLocale("fr", 1);
+
+    context.setSupportedLocale(std::make_shared<LocaleFr>());
+    assert(registered && !context.getCatalog("fr") && "T26: Le catalogue remplacé doit être oublié.");
+    assert(context.getLocale() == context.getHandle("fr").get() && context.getLocale()->getSignInTitle() == "Connexion" && "T26: La sélection doit retomber sur la nouvelle locale.");
+    assert(context.getHandle("fr", 1) == context.getHandle("fr") && "T26: Les variantes du catalogue doivent être supprimées.");
+    assert(context.validateCatalogs("en").empty() && "T26: Le catalogue remplacé ne doit plus être validé.");
+
+    CatalogDelta delta("fr", 0, 1);
+    delta.set("signInTitle", "Ouvrir une session");
+    bool applied = context.applyDelta<LocaleCatalog>(delta);
+    assert(!applied && context.getHandle("fr")->getSignInTitle() == "Connexion" && "T26: Un delta ne doit pas remplacer la locale.");
+    (void)registered;
+    (void)applied;
+}
+
+// Test 27: Layers and variants keep the locale type they were registered with when rebased
+class BracketedCatalog : public LocaleCatalog {
+    public:
+        explicit BracketedCatalog(std::shared_ptr<const Catalog> catalog) : LocaleCatalog(catalog) {}
+
+        const std::string getSignInTitle() const override { return "[" + LocaleCatalog::getSignInTitle() + "]"; }
+};
+
+void test_RebasedLocaleType() {
+    std::shared_ptr<Catalog> fr(new Catalog("fr", defaultCatalogKeys()));
+    fr->set(SignInTitle, "Connexion");
+    std::shared_ptr<Catalog> frCA(new Catalog("fr-CA", fr));
+    frCA->set(SignUpTitle, "S'inscrire");
+    std::shared_ptr<Catalog> shortCopy(new Catalog("fr", fr));
+    shortCopy->set(SignUpTitle, "Créer un compte");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    context.setSupportedCatalog<BracketedCatalog>(frCA);
+    bool registered = context.setSupportedVariant<BracketedCatalog>(1, shortCopy);
+
+    CatalogDelta delta("fr", 0, 1);
+    delta.set("signInTitle", "Se connecter");
+    bool applied = context.applyDelta<LocaleCatalog>(delta);
+    assert(registered && applied && "T27: applyDelta() a échoué.");
+    assert(context.getHandle("fr")->getSignInTitle() == "Se connecter" && "T27: 'fr' doit suivre le delta.");
+    assert(context.getHandle("fr-CA")->getSignInTitle() == "[Se connecter]" && "T27: fr-CA doit garder son type.");
+    assert(context.getHandle("fr", 1)->getSignInTitle() == "[Se connecter]" && "T27: La variante doit garder son type.");
+    (void)registered;
+    (void)applied;
+}
+
+// Test 28: Handles and scopes keep their locale when the context reloads it
+void test_HandleOutlivesReload() {
+    std::shared_ptr<Catalog> fr(new Catalog("fr", defaultCatalogKeys()));
+    fr->set(SignInTitle, "Connexion");
+    std::shared_ptr<Catalog> shortCopy(new Catalog("fr", fr));
+    shortCopy->set(SignUpTitle, "Créer un compte");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    bool registered = context.setSupportedVariant<LocaleCatalog>(1, shortCopy) && context.setLocale("fr");
+    LocaleHandle<DefaultLocale> selected = context.getHandle();
+    LocaleHandle<DefaultLocale> variant = context.getHandle("fr", 1);
+    {
+        LocaleScope<DefaultLocale> scope(context.getHandle("fr"));
+
+        CatalogDelta delta("fr", 0, 1);
+        delta.set("signInTitle", "Se connecter");
+        bool applied = context.applyDelta<LocaleCatalog>(delta);
+        assert(registered && applied && context.getHandle("fr")->getSignInTitle() == "Se connecter" && "T28: Rechargement échoué.");
+        assert(LocaleHandle<DefaultLocale>::current()->getSignInTitle() == "Connexion" && "T28: Le scope doit garder sa locale.");
+        (void)applied;
+    }
+    assert(selected != context.getHandle() && selected->getSignInTitle() == "Connexion" && "T28: Le handle doit survivre au rechargement.");
+    assert(variant->getSignUpTitle() == "Créer un compte" && "T28: Le handle de variante doit survivre au rechargement.");
+
+    context.setSupportedLocale(std::make_shared<LocaleFr>());
+    assert(context.getHandle("fr", 1) == context.getHandle("fr") && "T28: Les variantes du catalogue remplacé doivent être supprimées.");
+    assert(variant->getSignUpTitle() == "Créer un compte" && variant->getSignInTitle() == "Connexion" && "T28: Une variante supprimée doit rester lisible par ses handles.");
+    (void)registered;
+}
+
 // --- Main ---
 int main() {
     std::cout << "--- Démarrage des tests I18n C++11 ---" << std::endl;
@@ -96,6 +844,30 @@ int main() {
     runTest("2. Explicit Locale 'en' Check", test_DefautLocaleEn);
     runTest("3. Single Locale Default Check", test_DefaultLocaleFirst);
     runTest("4. Specific Locale 'fr' Data Check", test_SetupLocaleFr);
+    runTest("5. Async Locale Wait Check", test_AsyncLocaleWait);
+    runTest("6. Async Locale Fallback Check", test_AsyncLocaleFallback);
+    runTest("7. Context Shared Locales Check", test_ContextSharedLocales);
+    runTest("8. Layered Catalog Check", test_LayeredCatalog);
+    runTest("9. Catalog UTF-8 Check", test_CatalogUtf8);
+    runTest("10. Collation Check", test_Collation);
+    runTest("11. Case Mapping Check", test_CaseMapping);
+    runTest("12. Text Metrics Check", test_TextMetrics);
+    runTest("13. UTF-16 / UTF-32 Catalog Check", test_EncodedCatalog);
+    runTest("14. Catalog Export Check", test_CatalogExport);
+    runTest("15. Catalog Delta Check", test_CatalogDelta);
+    runTest("16. Catalog Validation Check", test_ValidateCatalogs);
+    runTest("17. Message Cache Check", test_MessageCache);
+    runTest("18. Gettext .mo Check", test_MoFile);
+    runTest("19. Memory Report Check", test_MemoryReport);
+    runTest("20. Locale Propagation Check", test_LocalePropagation);
+    runTest("21. Compressed Catalog Check", test_CompressedCatalog);
+    runTest("22. Variant Check", test_Variants);
+    runTest("23. Null Loader Check", test_NullLoader);
+    runTest("24. Layer Delta Check", test_LayerFollowsDelta);
+    runTest("25. Nested parallelFor Check", test_NestedParallelFor);
+    runTest("26. Catalog Replaced By Locale Check", test_CatalogReplacedByLocale);
+    runTest("27. Rebased Locale Type Check", test_RebasedLocaleType);
+    runTest("28. Handle Outlives Reload Check", test_HandleOutlivesReload);
 
     std::cout << "--- Tous les tests ont réussi ! ---" << std::endl;
     return EXIT_SUCCESS;
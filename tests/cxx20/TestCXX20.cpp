@@ -12,6 +12,19 @@
 #include "I18n.hpp" 
 #include "SupportedLocales.hpp"
 #include "SystemCode.hpp"
+#include "LocaleDE.hpp"
+#include "LocalePT.hpp"
+#include "LocaleCatalog.hpp"
+#include "LocaleMo.hpp"
+#include "LocaleCompressed.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <coroutine>
+#include <future>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
 
 #if defined(__APPLE__)
     #include <CoreFoundation/CoreFoundation.h>
@@ -45,7 +58,7 @@ TEST(I18nTest, DefautLocaleEn_2) {
 
 // Test 3: If no systemLocale & No 'en' take first found (variadic_locales)
 TEST(I18nTest, DefaultLocaleFirst_3) {
-    auto& i18n = I18n<DefaultLocale>::getInstance();
+    I18nContext<DefaultLocale> i18n; // own context: the singleton already holds 'en' from the previous tests
 
     // Inject the locales using the compile-time tuple method
     i18n.setSupportedLocales<LocaleEs>();
@@ -76,4 +89,843 @@ TEST(I18nTest, SetupLocaleFr_4) {
     EXPECT_EQ(current->getLoginSubTitle(), "Bienvenue !");
     EXPECT_EQ(current->getSignInTitle(), "Connexion");
     EXPECT_EQ(current->getSignUpTitle(), "Inscription");
-}
\ No newline at end of file
+}
+
+// Test 5: Async loading, setLocale() waits for a locale loaded in background
+TEST(I18nTest, AsyncLocaleWait_5) {
+    auto& i18n = I18n<DefaultLocale>::getInstance();
+
+    i18n.addLocaleLoader<LocaleEs>("es");
+    i18n.addLocaleLoader<LocaleDe>("de");
+    i18n.loadLocalesAsync();
+
+    EXPECT_TRUE(i18n.setLocale("de")) << "setLocale must wait for the background load.";
+    ASSERT_NE(i18n.getLocale(), nullptr);
+    EXPECT_EQ(i18n.getLocale()->getButtonCancel(), "Abbrechen");
+}
+
+// Test 6: Async loading, Fallback keeps the current locale until the load is done
+TEST(I18nTest, AsyncLocaleFallback_6) {
+    auto& i18n = I18n<DefaultLocale>::getInstance();
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+
+    i18n.addLocaleLoader<LocaleEs>("es");
+    i18n.addLocaleLoader("pt", [opened] {
+        opened.wait();
+        return std::unique_ptr<DefaultLocale>(std::make_unique<LocalePt>());
+    });
+    i18n.loadLocalesAsync(LocaleLoadPolicy::Fallback);
+    i18n.setLocale("es");
+
+    EXPECT_TRUE(i18n.isLocaleReady("es")) << "The priority locale must be loaded synchronously.";
+    EXPECT_FALSE(i18n.isLocaleReady("pt"));
+    EXPECT_FALSE(i18n.setLocale("pt")) << "setLocale must not block with Fallback.";
+    EXPECT_EQ(i18n.getLocale()->languageCode(), "es");
+
+    gate.set_value();
+    i18n.waitForLocales();
+
+    EXPECT_TRUE(i18n.setLocale("pt"));
+    EXPECT_EQ(i18n.getLocale()->getButtonCancel(), "Cancelar");
+}
+
+// Test 7: Independent contexts sharing the same locale instances
+TEST(I18nTest, ContextSharedLocales_7) {
+    I18nContext<DefaultLocale> tenantA;
+    I18nContext<DefaultLocale> tenantB;
+
+    tenantA.setSupportedLocales<LocaleEn, LocaleFr>();
+    tenantB.setSupportedLocales<LocaleFr>();
+
+    ASSERT_TRUE(tenantA.setLocale("fr"));
+    ASSERT_TRUE(tenantB.setLocale("fr"));
+    EXPECT_EQ(tenantA.getLocale(), tenantB.getLocale()) << "Contexts must share the 'fr' instance.";
+    EXPECT_FALSE(tenantB.setLocale("en")) << "'en' is not supported by tenant B.";
+
+    I18nContext<DefaultLocale> copy = tenantA;
+    EXPECT_TRUE(copy.setLocale("en"));
+    EXPECT_EQ(tenantA.getLocale()->languageCode(), "fr") << "A copy must not change the original.";
+    EXPECT_EQ(copy.size(), 2u);
+
+    I18n<DefaultLocale>::getInstance().setLocale("fr");
+    EXPECT_EQ(I18n<DefaultLocale>::getInstance().getLocale(), tenantA.getLocale()) << "The singleton must share 'fr'.";
+}
+
+// Test 8: Layered catalog, fr-CA overrides a key of fr and shares the others
+TEST(I18nTest, LayeredCatalog_8) {
+    auto fr = std::make_shared<Catalog>("fr", defaultCatalogKeys());
+    fr->set(SignUpTitle, "Inscription");
+    fr->set(SignInTitle, "Connexion");
+    fr->set(LoginSubTitle, "Bienvenue !");
+    fr->set(ButtonSubmit, "Valider");
+    fr->set(ButtonCancel, "Annuler");
+
+    auto frCA = std::make_shared<Catalog>("fr-CA", fr);
+    frCA->set("signInTitle", "Ouvrir une session");
+
+    EXPECT_EQ(frCA->find(SignUpTitle), fr->find(SignUpTitle)) << "fr-CA must share the strings of fr.";
+    EXPECT_TRUE(frCA->overrides(SignInTitle));
+    EXPECT_FALSE(frCA->overrides(SignUpTitle));
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(frCA);
+
+    ASSERT_TRUE(context.setLocale("fr-CA"));
+    EXPECT_EQ(context.getLocale()->getSignInTitle(), "Ouvrir une session");
+    EXPECT_EQ(context.getLocale()->getButtonCancel(), "Annuler");
+    EXPECT_EQ(context.getCatalog("fr-CA"), frCA);
+
+    auto reloaded = std::make_shared<Catalog>(*fr);
+    reloaded->set(SignUpTitle, "S'inscrire");
+    auto layer = std::make_shared<Catalog>(*frCA);
+    ASSERT_TRUE(layer->rebase(reloaded));
+    EXPECT_EQ(layer->text(SignUpTitle), "S'inscrire") << "Inherited keys must follow the new parent.";
+    EXPECT_EQ(layer->text(SignInTitle), "Ouvrir une session") << "Overrides must be kept.";
+    EXPECT_TRUE(layer->erase(SignInTitle));
+    EXPECT_EQ(layer->text(SignInTitle), "Connexion");
+}
+
+// Test 9: Catalog strings are validated as UTF-8 and normalized to NFC
+TEST(I18nTest, CatalogUtf8_9) {
+    auto fr = std::make_shared<Catalog>("fr", defaultCatalogKeys());
+
+    EXPECT_TRUE(Utf8::validate("Bienvenue \xF0\x9F\x98\x80"));
+    EXPECT_FALSE(Utf8::validate("\xED\xA0\x80")) << "Surrogates are invalid.";
+    EXPECT_FALSE(Utf8::validate("\xC0\xAF")) << "Overlong forms are invalid.";
+
+    EXPECT_FALSE(fr->set(SignInTitle, "Conn\xC3\x28xion"));
+    EXPECT_EQ(fr->find(SignInTitle), nullptr);
+    EXPECT_TRUE(fr->set(ButtonSubmit, "Valide\xCC\x81"));
+    EXPECT_EQ(fr->text(ButtonSubmit), "Valid\xC3\xA9") << "Strings must be stored in NFC.";
+}
+
+// Test 10: Collation, sort keys follow the alphabet of the language
+TEST(I18nTest, Collation_10) {
+    const Collator& root = Collator::forLanguage("");
+    std::vector<std::string> words = {"b", "\xC3\xA1", "A", "a"};
+    root.sort(words);
+    EXPECT_EQ(words, (std::vector<std::string>{"a", "A", "\xC3\xA1", "b"})) << "Case is a tertiary difference, accents a secondary one.";
+    EXPECT_LT(root.sortKey("Cote"), root.sortKey("c\xC3\xB4te"));
+
+    const Collator& es = Collator::forLanguage("es-ES");
+    EXPECT_LT(es.compare("nube", "\xC3\xB1u"), 0);
+    EXPECT_LT(es.compare("\xC3\xB1u", "oso"), 0) << "'ñ' sorts between 'n' and 'o' in Spanish.";
+    EXPECT_LT(root.compare("\xC3\xB1u", "nz"), 0) << "'ñ' is an accented 'n' in the root order.";
+
+    const Collator& sv = Collator::forLanguage("sv");
+    EXPECT_LT(sv.compare("zebra", "\xC3\xA5ska"), 0) << "'å' sorts after 'z' in Swedish.";
+    EXPECT_LT(sv.compare("\xC3\xA5ska", "\xC3\xA4pple"), 0);
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedLocales<LocaleDe>();
+    ASSERT_TRUE(context.setLocale("de"));
+    EXPECT_EQ(context.getCollator().languageCode(), "de");
+    EXPECT_EQ(&context.getCollator(), &context.getLocale()->collator()) << "The locale exposes its collator.";
+}
+
+// Test 11: Case mapping and accent folding follow the rules of the language
+TEST(I18nTest, CaseMapping_11) {
+    std::string out;
+    char buffer[8];
+
+    CaseMap::forLanguage("").toLower("STRASSE \xCE\x9F\xCE\x94\xCE\xA5\xCE\xA3\xCE\xA3\xCE\x95\xCE\xA5\xCE\xA3", out); // "ΟΔΥΣΣΕΥΣ"
+    EXPECT_EQ(out, "strasse \xCE\xBF\xCE\xB4\xCF\x85\xCF\x83\xCF\x83\xCE\xB5\xCF\x85\xCF\x82") << "Final sigma expected.";
+    CaseMap::forLanguage("de-DE").toUpper("Stra\xC3\x9F" "e", out);
+    EXPECT_EQ(out, "STRASSE");
+    CaseMap::forLanguage("tr").toUpper("istanbul", out);
+    EXPECT_EQ(out, "\xC4\xB0STANBUL") << "Turkish 'i' uppercases to 'İ'.";
+    CaseMap::forLanguage("tr").toLower("DIYARBAKIR", out);
+    EXPECT_EQ(out, "d\xC4\xB1yarbak\xC4\xB1r") << "Turkish 'I' lowercases to 'ı'.";
+    CaseMap::forLanguage("").fold("Cr\xC3\xA8me Br\xC3\xBBl\xC3\xA9" "e \xC3\x91" "and\xC3\xBA", out);
+    EXPECT_EQ(out, "creme brulee nandu");
+    CaseMap::forLanguage("es").fold("\xC3\x91" "and\xC3\xBA", out);
+    EXPECT_EQ(out, "\xC3\xB1" "andu") << "Spanish keeps 'ñ' as a letter.";
+
+    EXPECT_EQ(CaseMap::forLanguage("").toUpper("abcd\xC3\xA9\xC3\xA9", 8, buffer, 5), 8u) << "The full length is returned.";
+    EXPECT_EQ(std::string(buffer, 4), "ABCD") << "Only whole code points are written.";
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedLocales<LocaleDe>();
+    ASSERT_TRUE(context.setLocale("de"));
+    EXPECT_EQ(&context.getCaseMap(), &context.getLocale()->caseMap());
+}
+
+// Test 12: Compile-time locale selection, unknown codes are rejected at compile time
+template <typename T_Context, FixedString Code>
+concept CanSelectLocale = requires (T_Context context) { context.template setLocale<Code>(); };
+
+TEST(I18nTest, CompileTimeLocale_12) {
+    using Registry = LocaleRegistry<DefaultLocale, SupportedLocales>;
+    static_assert(Registry::indexOf("fr") == 2);
+    static_assert(!Registry::contains("de"));
+    static_assert(std::is_same_v<Registry::Locale<"it">, LocaleIt>);
+    static_assert(CanSelectLocale<StaticI18nContext<DefaultLocale, SupportedLocales>, "fr">);
+    static_assert(!CanSelectLocale<StaticI18nContext<DefaultLocale, SupportedLocales>, "de">);
+
+    StaticI18nContext<DefaultLocale, SupportedLocales> context;
+    context.setLocale<"fr">();
+    EXPECT_EQ(context.getLocale(), context.getLocale<"fr">());
+    EXPECT_EQ(context.getLocale<"fr">()->getSignInTitle(), "Connexion");
+    EXPECT_EQ(context.size(), 4u);
+
+    ASSERT_TRUE(context.setLocale("en")) << "Runtime codes still work.";
+    EXPECT_EQ(context.getLocale(), context.getLocale<"en">());
+
+    auto fr = std::make_shared<Catalog>("fr", defaultCatalogKeys());
+    fr->set(SignInTitle, "Se connecter");
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    EXPECT_EQ(context.getCatalog("fr"), nullptr) << "The codes of the tuple are frozen.";
+    EXPECT_EQ(context.getHandle("fr").get(), context.getLocale<"fr">()) << "The slot stays the registered instance.";
+    context.setSupportedLocale(std::make_shared<LocaleDe>());
+    EXPECT_TRUE(context.setLocale("de")) << "Other codes can still be registered.";
+}
+
+// Test 13: Text metrics, display width and grapheme clusters measured when strings are set
+TEST(I18nTest, TextMetrics_13) {
+    auto fr = std::make_shared<Catalog>("fr", defaultCatalogKeys());
+    auto family = TextMetrics::measure("\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7"); // family ZWJ sequence
+
+    EXPECT_EQ(family.graphemes(), 1u) << "A ZWJ sequence is a single grapheme.";
+    EXPECT_EQ(family.width(), 2u);
+    EXPECT_EQ(TextMetrics::measure("Bonjour").width(), 7u);
+
+    EXPECT_EQ(fr->metrics(SignInTitle), nullptr);
+    ASSERT_TRUE(fr->set(SignInTitle, "Caf\xC3\xA9 \xE6\x9D\xB1\xE4\xBA\xAC")); // "Café 東京"
+    const TextMetrics* metrics = fr->metrics(SignInTitle);
+    ASSERT_NE(metrics, nullptr);
+    EXPECT_EQ(metrics->bytes(), 12u);
+    EXPECT_EQ(metrics->width(), 9u) << "Ideographs take two columns.";
+    EXPECT_EQ(metrics->graphemes(), 7u);
+    EXPECT_EQ(metrics->prefixBytes(6), 6u) << "An ideograph is never cut in half.";
+    EXPECT_EQ(metrics->prefixGraphemes(6), 5u);
+    EXPECT_TRUE(fr->erase(SignInTitle));
+    EXPECT_EQ(fr->metrics(SignInTitle), nullptr);
+}
+
+// Test 14: UTF-16 / UTF-32, transcoded once per locale and shared
+TEST(I18nTest, EncodedCatalog_14) {
+    auto ja = std::make_shared<Catalog>("ja", defaultCatalogKeys());
+    ja->set(SignInTitle, "\xE3\x83\xAD\xE3\x82\xB0\xE3\x82\xA4\xE3\x83\xB3 \xF0\x9F\x94\x91"); // "ログイン 🔑"
+    ja->set(ButtonSubmit, "Submit the registration form now");
+
+    EXPECT_EQ(Utf8::toUtf16("Caf\xC3\xA9 \xF0\x9F\x98\x80"), u"Caf\u00E9 \U0001F600") << "Surrogate pair expected.";
+    EXPECT_EQ(Utf8::toUtf32("Caf\xC3\xA9 \xF0\x9F\x98\x80"), U"Caf\u00E9 \U0001F600");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(ja);
+    ASSERT_TRUE(context.setLocale("ja"));
+    const auto* utf16 = context.getUtf16();
+    ASSERT_NE(utf16, nullptr);
+    EXPECT_EQ(utf16, context.getUtf16()) << "The UTF-16 pool is cached with the locale.";
+    EXPECT_EQ(utf16->text(SignInTitle), u"\u30ED\u30B0\u30A4\u30F3 \U0001F511");
+    EXPECT_EQ(utf16->text(ButtonSubmit), u"Submit the registration form now");
+    EXPECT_TRUE(utf16->text(SignUpTitle).empty());
+    EXPECT_EQ(utf16->data(SignUpTitle)[0], u'\0');
+    ASSERT_NE(context.getUtf32(), nullptr);
+    EXPECT_EQ(context.getUtf32()->text(SignInTitle).size(), 6u);
+
+    I18nContext<DefaultLocale> english;
+    english.setSupportedLocales<LocaleEn>();
+    EXPECT_EQ(english.getUtf16(), nullptr) << "Only catalog locales have encoded pools.";
+}
+
+// Test 15: Catalog export, streamed JSON / binary and content hash
+TEST(I18nTest, CatalogExport_15) {
+    auto fr = std::make_shared<Catalog>("fr", defaultCatalogKeys());
+    fr->set(SignInTitle, "Connexion");
+    fr->set(LoginSubTitle, "Dites \"bonjour\"\n\x01");
+    fr->set(ButtonSubmit, "Valider");
+
+    std::ostringstream json;
+    CatalogExporter(fr).write(json, ExportFormat::Json);
+    EXPECT_EQ(json.str(), R"({"signInTitle":"Connexion","loginSubTitle":"Dites \"bonjour\"\n\u0001","buttonSubmit":"Valider"})");
+
+    std::vector<std::string> names = {"buttonSubmit", "unknownKey", "signUpTitle"};
+    CatalogExporter subset(fr, names);
+    std::ostringstream binary;
+    subset.write(binary, ExportFormat::Binary);
+    EXPECT_EQ(subset.keys().size(), 2u) << "Unknown keys are ignored.";
+    EXPECT_EQ(binary.str().substr(0, 5), "I18N\x01");
+    EXPECT_EQ(binary.str().substr(13), "\x02" "fr" "\x01" "\x0C" "buttonSubmit" "\x07" "Valider");
+    EXPECT_EQ(subset.etag().size(), 18u);
+
+    auto copy = std::make_shared<Catalog>(*fr);
+    EXPECT_EQ(CatalogExporter(copy).hash(), CatalogExporter(fr).hash()) << "The hash only depends on the content.";
+    copy->set(ButtonSubmit, "Envoyer");
+    EXPECT_NE(CatalogExporter(copy).hash(), CatalogExporter(fr).hash());
+    EXPECT_NE(CatalogExporter(copy, names).hash(), subset.hash());
+    names.pop_back();
+    EXPECT_EQ(CatalogExporter(fr, names).hash(), subset.hash()) << "Missing keys do not change the hash.";
+
+    LocaleCatalog locale(fr);
+    EXPECT_EQ(locale.contentHash(), CatalogExporter(fr).hash());
+}
+
+// Test 16: Catalog delta, new snapshot sharing the unchanged strings
+TEST(I18nTest, CatalogDelta_16) {
+    auto fr = std::make_shared<Catalog>("fr", defaultCatalogKeys());
+    fr->set(SignUpTitle, "Inscription");
+    fr->set(SignInTitle, "Connexion");
+    fr->set(ButtonCancel, "Annuler");
+    fr->setVersion(41);
+    auto frCA = std::make_shared<Catalog>("fr-CA", fr);
+    frCA->set(SignUpTitle, "S'inscrire");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    context.setSupportedCatalog<LocaleCatalog>(frCA);
+    ASSERT_TRUE(context.setLocale("fr"));
+
+    CatalogDelta delta("fr", 41, 42);
+    delta.set("signInTitle", "Se connecter");
+    delta.set("buttonSubmit", "Valider");
+    delta.remove("buttonCancel");
+
+    std::stringstream wire;
+    delta.write(wire);
+    auto parsed = CatalogDelta::read(wire);
+    ASSERT_NE(parsed, nullptr);
+    EXPECT_EQ(parsed->changes().size(), 3u);
+    EXPECT_EQ(CatalogDelta("fr", 40, 41).apply(*fr), nullptr) << "A delta only applies to its base version.";
+
+    ASSERT_TRUE(context.applyDelta<LocaleCatalog>(*parsed));
+    EXPECT_EQ(context.getCatalog("fr")->version(), 42u);
+    EXPECT_EQ(context.getLocale()->getSignInTitle(), "Se connecter");
+    EXPECT_EQ(context.getLocale()->getButtonSubmit(), "Valider");
+    EXPECT_EQ(context.getLocale()->getButtonCancel(), "");
+    EXPECT_EQ(context.getCatalog("fr")->entry(SignUpTitle), fr->entry(SignUpTitle)) << "Unchanged strings are shared.";
+    EXPECT_EQ(fr->text(SignInTitle), "Connexion") << "The previous snapshot is not modified.";
+    EXPECT_EQ(context.getHandle("fr-CA")->getSignInTitle(), "Se connecter") << "Layers over the catalog follow the delta.";
+    EXPECT_EQ(context.getHandle("fr-CA")->getSignUpTitle(), "S'inscrire");
+    EXPECT_FALSE(context.applyDelta<LocaleCatalog>(delta)) << "A delta applies once.";
+}
+
+// Test 17: Cross-locale validation of the registered catalogs
+TEST(I18nTest, ValidateCatalogs_17) {
+    auto en = std::make_shared<Catalog>("en", defaultCatalogKeys());
+    en->set(SignUpTitle, "Sign up");
+    en->set(SignInTitle, "Welcome back, {name}");
+    en->set(LoginSubTitle, "{count, plural, one {# new message} other {# new messages}}");
+    auto fr = std::make_shared<Catalog>("fr", defaultCatalogKeys());
+    fr->set(SignInTitle, "Bon retour, {nom}");
+    fr->set(LoginSubTitle, "{count, plural, one {# nouveau message} other {# nouveaux messages}");
+    fr->set(ButtonSubmit, "Valider");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(en);
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    ThreadPool pool(2);
+    auto issues = context.validateCatalogs("en", pool);
+
+    ASSERT_EQ(issues.size(), 4u);
+    EXPECT_EQ(issues[0].error, ValidationError::ExtraKey);
+    EXPECT_EQ(issues[0].key, "buttonSubmit");
+    EXPECT_EQ(issues[1].error, ValidationError::InvalidSyntax) << issues[1].detail;
+    EXPECT_EQ(issues[1].key, "loginSubTitle");
+    EXPECT_EQ(issues[2].error, ValidationError::PlaceholderMismatch);
+    EXPECT_EQ(issues[2].key, "signInTitle");
+    EXPECT_EQ(issues[3].error, ValidationError::MissingKey);
+    EXPECT_EQ(issues[3].key, "signUpTitle");
+    EXPECT_EQ(context.validateCatalogs("en").size(), issues.size()) << "The sequential run finds the same issues.";
+    auto missing = context.validateCatalogs("de", pool);
+    ASSERT_EQ(missing.size(), 1u) << "The reference must be registered.";
+    EXPECT_EQ(missing[0].error, ValidationError::MissingReference);
+    EXPECT_EQ(missing[0].languageCode, "de");
+
+    std::string signature;
+    std::string error;
+    EXPECT_TRUE(CatalogValidator::parse("{n, select, a {{x}} other {'{'}} {x}", signature, error)) << error;
+    EXPECT_EQ(signature, "n:select,x");
+    EXPECT_FALSE(CatalogValidator::parse("{n, plural, one {#}}", signature, error)) << "An 'other' arm is required.";
+}
+
+// Test 18: Message cache, formatted messages memoized per catalog, key and arguments
+TEST(I18nTest, MessageCache_18) {
+    auto en = std::make_shared<Catalog>("en", defaultCatalogKeys());
+    en->set(LoginSubTitle, "{count, plural, one {# new message} other {# new messages}}");
+    auto fr = std::make_shared<Catalog>("fr", defaultCatalogKeys());
+    fr->set(LoginSubTitle, "{count, plural, one {# nouveau message} other {# nouveaux messages}}");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(en);
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    context.setLocale("en");
+    context.enableMessageCache(2);
+
+    FormatArguments one;
+    one.add("count", 1);
+    FormatArguments three;
+    three.add("count", 3);
+    EXPECT_EQ(context.format(LoginSubTitle, one), "1 new message");
+    EXPECT_EQ(context.format(LoginSubTitle, three), "3 new messages");
+    EXPECT_EQ(context.format(LoginSubTitle, three), "3 new messages");
+    EXPECT_EQ(context.getMessageCache()->stats().hits, 1u) << "A repeated call must be served from the cache.";
+    EXPECT_EQ(context.getMessageCache()->stats().misses, 2u);
+
+    context.setLocale("fr");
+    FormatArguments zero;
+    zero.add("count", 0);
+    EXPECT_EQ(context.format(LoginSubTitle, zero), "0 nouveau message") << "French puts 0 in 'one'.";
+    EXPECT_EQ(context.format(LoginSubTitle, three), "3 nouveaux messages");
+
+    CatalogDelta delta("fr", 0, 1);
+    delta.set("loginSubTitle", "{count, plural, one {# message} other {# messages}}");
+    ASSERT_TRUE(context.applyDelta<LocaleCatalog>(delta));
+    EXPECT_EQ(context.format(LoginSubTitle, three), "3 messages") << "A reloaded catalog must not hit the entries of the old one.";
+
+    auto stats = context.getMessageCache()->stats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 5u);
+    EXPECT_LE(stats.size, context.getMessageCache()->capacity());
+    EXPECT_DOUBLE_EQ(stats.hitRate(), 1.0 / 6.0);
+    EXPECT_TRUE(context.format(ButtonSubmit + 100, one).empty());
+
+    I18nContext<DefaultLocale> copy(context);
+    copy.setLocale("en");
+    EXPECT_EQ(copy.format(LoginSubTitle, three), "3 new messages");
+    EXPECT_EQ(context.format(LoginSubTitle, three), "3 messages");
+    EXPECT_EQ(context.getMessageCache()->stats().hits, 3u) << "A copy switching locale must not flush the cache of the others.";
+    EXPECT_EQ(context.getMessageCache()->stats().misses, 5u);
+    EXPECT_NE(Catalog(*fr).id(), fr->id()) << "A copied catalog gets its own id.";
+
+    MessageCache cache(4, 1);
+    for (int count = 0; count < 6; ++count) {
+        FormatArguments arguments;
+        arguments.add("count", count);
+        cache.format(*en, LoginSubTitle, arguments);
+    }
+    EXPECT_EQ(cache.stats().size, 4u);
+    EXPECT_EQ(cache.stats().evictions, 2u);
+}
+
+// Test 19: Gettext .mo, strings looked up through the embedded hash table
+TEST(I18nTest, MoFile_19) {
+    std::vector<std::pair<std::string, std::string>> entries = {
+        {"", "Language: pl\nPlural-Forms: nplurals=3; plural=(n==1 ? 0 : n%10>=2 && n%10<=4 && (n%100<10 || n%100>=20) ? 1 : 2);\n"},
+        {"Sign up", "Zarejestruj się"},
+        {"Cancel", "Anuluj"},
+        {std::string("file\0files", 10), std::string("plik\0pliki\0plików", 18)}
+    };
+
+    for (auto bigEndian : {false, true}) {
+        ASSERT_TRUE(writeMoFile("test_pl.mo", entries, bigEndian));
+        auto file = MoFile::open("test_pl.mo");
+        ASSERT_NE(file, nullptr);
+        EXPECT_EQ(file->languageCode(), "pl");
+        EXPECT_EQ(file->pluralCount(), 3u);
+        EXPECT_EQ(file->find("Cancel"), "Anuluj");
+        EXPECT_FALSE(file->find("Missing").has_value());
+        EXPECT_EQ(file->text("file", "files", 1), "plik");
+        EXPECT_EQ(file->text("file", "files", 3), "pliki");
+        EXPECT_EQ(file->text("file", "files", 5), "plików");
+        EXPECT_EQ(file->text("file", "files", 22), "pliki");
+    }
+
+    I18nContext<DefaultLocale> context;
+    ASSERT_TRUE(context.setSupportedMoFile<LocaleMo>("test_pl.mo"));
+    ASSERT_TRUE(context.setLocale("pl"));
+    EXPECT_EQ(context.getLocale()->getSignUpTitle(), "Zarejestruj się");
+    EXPECT_EQ(context.getLocale()->getSignInTitle(), "Sign in") << "A missing msgid is returned untranslated.";
+
+    ASSERT_TRUE(writeMoFile("test_pl.mo", entries, false, false));
+    EXPECT_EQ(MoFile::open("test_pl.mo")->text("Sign up"), "Zarejestruj się") << "Files without hash table are searched by dichotomy.";
+    std::ofstream("test_pl.mo", std::ios::binary) << "not a mo file, too short";
+    EXPECT_EQ(MoFile::open("test_pl.mo"), nullptr);
+    EXPECT_FALSE(context.setSupportedMoFile<LocaleMo>("missing.mo"));
+
+    std::string chain("n");
+    for (int k = 0; k < 100000; ++k)
+        chain += "+n";
+    PluralExpression sum;
+    EXPECT_TRUE(sum.parse("n+n+n"));
+    EXPECT_FALSE(sum.parse(chain)) << "A long left-associative chain is too tall to evaluate.";
+    EXPECT_EQ(sum.evaluate(2), 6u) << "A rejected expression keeps the current one.";
+    entries[0].second = "Language: pl\nPlural-Forms: nplurals=3; plural=" + chain + ";\n";
+    ASSERT_TRUE(writeMoFile("test_pl.mo", entries, false));
+    EXPECT_EQ(MoFile::open("test_pl.mo"), nullptr) << "A file whose Plural-Forms cannot be evaluated is rejected.";
+    std::remove("test_pl.mo");
+}
+
+// Test 20: Memory report, footprint per locale and per key
+TEST(I18nTest, MemoryReport_20) {
+    I18nContext<DefaultLocale> holder;
+    holder.setSupportedLocales<LocaleEn>(); // the shared LocaleEn instance is alive before counting
+    auto liveBefore = ILocale::liveCount();
+    {
+        auto fr = std::make_shared<Catalog>("fr", defaultCatalogKeys());
+        fr->set(SignUpTitle, "Inscription à la plateforme de démonstration");
+        fr->set(SignInTitle, "Connexion");
+        auto frCA = std::make_shared<Catalog>("fr-CA", std::shared_ptr<const Catalog>(fr));
+        frCA->set(SignInTitle, "Ouvrir une session sur la plateforme");
+
+        I18nContext<DefaultLocale> context;
+        context.setSupportedCatalog<LocaleCatalog>(frCA);
+        context.setSupportedCatalog<LocaleCatalog>(fr);
+        context.setSupportedLocales<LocaleEn>();
+        auto report = context.memoryReport();
+
+        ASSERT_EQ(report.locales.size(), 3u);
+        EXPECT_EQ(report.locales[0].languageCode, "en");
+        EXPECT_EQ(report.locales[0].heapBytes, 0u) << "Compiled-in strings live in the binary.";
+        EXPECT_EQ(report.locales[1].languageCode, "fr");
+        EXPECT_EQ(report.locales[1].strings, 2u);
+        EXPECT_EQ(report.locales[1].sharedBytes, 0u);
+        EXPECT_EQ(report.locales[2].languageCode, "fr-CA");
+        EXPECT_GT(report.locales[2].sharedBytes, 0u) << "The inherited string belongs to 'fr'.";
+        EXPECT_EQ(report.locales[2].internedSavings, report.locales[2].sharedBytes);
+        EXPECT_EQ(report.liveLocales, liveBefore + 2) << "Two catalog locales built, LocaleEn shared.";
+
+        ASSERT_EQ(report.keys.size(), defaultCatalogKeys()->size());
+        EXPECT_EQ(report.keys[SignUpTitle].locales, 2u);
+        EXPECT_EQ(report.keys[SignUpTitle].bytes, report.locales[2].sharedBytes) << "A shared string is counted once per key.";
+        EXPECT_EQ(report.keys[SignInTitle].locales, 2u);
+        EXPECT_EQ(report.keys[ButtonCancel].bytes, 0u);
+        EXPECT_EQ(report.heapBytes(), report.locales[1].heapBytes + report.locales[2].heapBytes);
+    }
+    EXPECT_EQ(ILocale::liveCount(), liveBefore);
+}
+
+namespace {
+
+// Resumes the awaiting coroutine on a worker of the pool.
+struct PoolHop {
+    ThreadPool& pool;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> coroutine) const { pool.submit([coroutine] { coroutine.resume(); }); }
+    void await_resume() const noexcept {}
+};
+
+LocaleTask<DefaultLocale> checkLocaleAcrossHops(ThreadPool& pool, std::string expected, std::atomic<int>& mismatches) {
+    for (int hop = 0; hop < 3; ++hop) {
+        co_await PoolHop{pool};
+        if (LocaleHandle<DefaultLocale>::current()->languageCode() != expected)
+            ++mismatches;
+    }
+}
+
+LocaleTask<DefaultLocale> switchLocaleOnHop(LocaleHandle<DefaultLocale>, ThreadPool& pool, LocaleHandle<DefaultLocale> other, std::string& seen) {
+    seen = LocaleHandle<DefaultLocale>::current()->languageCode();
+    co_await withLocale(other, PoolHop{pool});
+    seen += "," + LocaleHandle<DefaultLocale>::current()->languageCode();
+    co_await PoolHop{pool};
+    seen += "," + LocaleHandle<DefaultLocale>::current()->languageCode();
+}
+
+} // namespace
+
+// Test 21: Locale propagated across executor hops and coroutine suspensions
+TEST(I18nTest, LocalePropagation_21) {
+    I18nContext<DefaultLocale> tenant;
+    tenant.setSupportedLocales<LocaleEn, LocaleFr, LocaleEs, LocaleDe, LocalePt>();
+    const std::vector<std::string> codes = {"en", "fr", "es", "de", "pt"};
+    ThreadPool pool(4);
+    std::atomic<int> mismatches = 0;
+
+    std::vector<LocaleTask<DefaultLocale>> tasks;
+    tasks.reserve(10000);
+    for (std::size_t i = 0; i < 10000; ++i) {
+        LocaleScope<DefaultLocale> scope(tenant.getHandle(codes[i % codes.size()]));
+        tasks.push_back(checkLocaleAcrossHops(pool, codes[i % codes.size()], mismatches));
+    }
+    EXPECT_FALSE(LocaleHandle<DefaultLocale>::current()) << "Suspended tasks must hand the thread back.";
+    for (auto& task : tasks)
+        task.get();
+    EXPECT_EQ(mismatches.load(), 0) << "Every task must resume with its own locale.";
+    EXPECT_TRUE(std::ranges::all_of(tasks, [](const auto& task) { return task.done(); }));
+
+    std::string seen;
+    auto task = switchLocaleOnHop(tenant.getHandle("de"), pool, tenant.getHandle("pt"), seen);
+    task.get();
+    EXPECT_EQ(task.locale(), tenant.getHandle("de"));
+    EXPECT_EQ(seen, "de,pt,de") << "withLocale applies to one resume, the task locale to the next ones.";
+    EXPECT_FALSE(pool.submit([] { return static_cast<bool>(LocaleHandle<DefaultLocale>::current()); }).get())
+        << "Workers must get their own locale back.";
+}
+
+// Test 22: Compressed catalog, blocks decompressed on demand with a shared dictionary
+TEST(I18nTest, CompressedCatalog_22) {
+    Catalog en("en", defaultCatalogKeys());
+    en.set(SignUpTitle, "Sign up to the demonstration platform");
+    en.set(SignInTitle, "Sign in to the demonstration platform");
+    en.set(LoginSubTitle, "Sign in to continue");
+    en.set(ButtonSubmit, "Submit");
+    en.set(ButtonCancel, "Cancel");
+    Catalog fr("fr", defaultCatalogKeys());
+    fr.set(SignUpTitle, "Inscription à la plateforme");
+    fr.set(SignInTitle, "Connexion à la plateforme");
+    fr.set(LoginSubTitle, "Connectez-vous pour continuer");
+    fr.set(ButtonSubmit, "Valider");
+
+    std::vector<std::string> samples;
+    for (std::size_t key = 0; key < en.size(); ++key) {
+        samples.push_back(en.text(key));
+        samples.push_back(fr.text(key));
+    }
+    auto dictionary = CompressionDictionary::train(samples);
+    auto compressedFr = std::make_shared<const CompressedCatalog>(fr, dictionary, 32, 1);
+    auto compressedEn = std::make_shared<const CompressedCatalog>(en, dictionary, 32, 1);
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCompressedCatalog<LocaleCompressed>(compressedEn);
+    context.setSupportedCompressedCatalog<LocaleCompressed>(compressedFr);
+    ASSERT_TRUE(context.setLocale("fr"));
+    EXPECT_EQ(compressedFr->blockCount(), 2u);
+    EXPECT_EQ(compressedFr->stats().misses, 0u) << "Nothing is decompressed when registering.";
+
+    EXPECT_EQ(context.getLocale()->getSignInTitle(), "Connexion à la plateforme");
+    EXPECT_EQ(context.getLocale()->getSignUpTitle(), "Inscription à la plateforme");
+    EXPECT_EQ(compressedFr->stats().misses, 1u);
+    EXPECT_EQ(compressedFr->stats().hits, 1u) << "The second key of the block is served from the cache.";
+    EXPECT_EQ(context.getLocale()->getButtonSubmit(), "Valider");
+    EXPECT_EQ(context.getLocale()->getButtonCancel(), "");
+    auto stats = compressedFr->stats();
+    EXPECT_EQ(stats.misses, 2u) << "A missing key does not decompress anything.";
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.residentBlocks, 1u) << "The cache is bounded to one block.";
+
+    std::stringstream stream;
+    compressedFr->write(stream);
+    auto parsed = CompressedCatalog::read(stream, dictionary);
+    ASSERT_NE(parsed, nullptr);
+    EXPECT_EQ(parsed->languageCode(), "fr");
+    EXPECT_EQ(parsed->text(LoginSubTitle), "Connectez-vous pour continuer");
+    EXPECT_FALSE(parsed->contains(ButtonCancel));
+    std::stringstream other;
+    compressedFr->write(other);
+    EXPECT_EQ(CompressedCatalog::read(other, CompressionDictionary::train({"Un autre dictionnaire"})), nullptr);
+    std::stringstream corrupted;
+    compressedFr->write(corrupted);
+    std::stringstream truncated(corrupted.str().substr(0, 18) + "\x01\xFF\xFF\xFF\xFF\x0F" + "abc"); // first block claims 4 GiB
+    EXPECT_EQ(CompressedCatalog::read(truncated, dictionary), nullptr) << "A truncated block is rejected without allocating its claimed size.";
+
+    auto report = context.memoryReport();
+    ASSERT_EQ(report.locales.size(), 2u);
+    EXPECT_EQ(report.locales[1].strings, 4u);
+    EXPECT_EQ(report.locales[0].sharedBytes, 0u);
+    EXPECT_GE(report.locales[1].sharedBytes, dictionary->memoryBytes()) << "The dictionary belongs to 'en'.";
+    EXPECT_GT(report.locales[0].heapBytes, report.locales[1].sharedBytes);
+}
+
+// Test 23: Translation variants, sparse layers selected per request
+TEST(I18nTest, Variants_23) {
+    auto fr = std::make_shared<Catalog>("fr", defaultCatalogKeys());
+    fr->set(SignUpTitle, "Inscription");
+    fr->set(SignInTitle, "Connexion");
+    auto en = std::make_shared<Catalog>("en", defaultCatalogKeys());
+    en->set(SignInTitle, "Sign in");
+    auto shortCopy = std::make_shared<Catalog>("fr", fr);
+    shortCopy->set(SignUpTitle, "Créer un compte");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    context.setSupportedCatalog<LocaleCatalog>(en);
+    EXPECT_FALSE(context.setSupportedVariant<LocaleCatalog>(0, shortCopy)) << "Variant 0 is the locale itself.";
+    EXPECT_FALSE(context.setSupportedVariant<LocaleCatalog>(1, nullptr));
+    EXPECT_FALSE(context.setSupportedVariant<LocaleCatalog>(1, std::make_shared<Catalog>("fr", defaultCatalogKeys()))) << "A variant is a layer over the locale's catalog.";
+    EXPECT_FALSE(context.setSupportedVariant<LocaleCatalog>(1, std::make_shared<Catalog>("de", en))) << "'de' has no catalog to layer over.";
+    ASSERT_TRUE(context.setSupportedVariant<LocaleCatalog>(1, shortCopy));
+    EXPECT_EQ(context.size(), 2u);
+
+    auto variant = context.getHandle("fr", 1);
+    ASSERT_TRUE(variant);
+    EXPECT_NE(variant, context.getHandle("fr"));
+    EXPECT_EQ(variant->getSignUpTitle(), "Créer un compte");
+    EXPECT_EQ(variant->getSignInTitle(), "Connexion") << "Keys not overridden fall back to the locale.";
+    EXPECT_EQ(context.getHandle("fr", 2), context.getHandle("fr")) << "An unknown variant falls back to the locale.";
+    EXPECT_EQ(context.getHandle("en", 1), context.getHandle("en"));
+    EXPECT_FALSE(context.getHandle("de", 1));
+
+    ASSERT_TRUE(context.setLocale("fr", 1));
+    EXPECT_EQ(context.getLocale(), variant.get());
+    EXPECT_FALSE(context.setLocale("de", 1));
+    EXPECT_EQ(context.getLocale(), variant.get());
+
+    CatalogDelta delta("fr", 0, 1);
+    delta.set("signInTitle", "Se connecter");
+    ASSERT_TRUE(context.applyDelta<LocaleCatalog>(delta));
+    auto rebased = context.getHandle("fr", 1);
+    EXPECT_NE(rebased, variant) << "The variant follows the new catalog.";
+    EXPECT_EQ(context.getLocale(), rebased.get()) << "The selection follows the variant.";
+    EXPECT_EQ(rebased->getSignInTitle(), "Se connecter");
+    EXPECT_EQ(rebased->getSignUpTitle(), "Créer un compte") << "Overrides are kept.";
+    EXPECT_FALSE(context.setSupportedVariant<LocaleCatalog>(2, shortCopy)) << "A layer over the replaced catalog is stale.";
+
+    auto report = context.memoryReport();
+    ASSERT_EQ(report.locales.size(), 3u);
+    EXPECT_EQ(report.locales[2].languageCode, "fr#1");
+    EXPECT_EQ(report.locales[2].strings, 2u);
+    EXPECT_GT(report.locales[2].sharedBytes, 0u) << "Inherited strings belong to 'fr'.";
+}
+
+// Test 24: A loader returning nullptr leaves its locale unregistered
+TEST(I18nTest, NullLoader_24) {
+    I18nContext<DefaultLocale> context;
+
+    context.addLocaleLoader("en", [] { return std::shared_ptr<DefaultLocale>(); });
+    context.addLocaleLoader<LocaleEs>("es");
+    context.addLocaleLoader("de", [] { return std::shared_ptr<DefaultLocale>(); });
+    context.loadLocalesAsync();
+
+    EXPECT_FALSE(context.setLocale("en")) << "A null locale must not be selectable.";
+    EXPECT_FALSE(context.setLocale("de"));
+    context.waitForLocales();
+    EXPECT_EQ(context.size(), 1u);
+    ASSERT_NE(context.getLocale(), nullptr);
+    EXPECT_EQ(context.getLocale()->languageCode(), "es");
+}
+
+// Test 25: Layers registered over a catalog follow it when a delta replaces it
+TEST(I18nTest, LayerFollowsDelta_25) {
+    auto fr = std::make_shared<Catalog>("fr", defaultCatalogKeys());
+    fr->set(SignUpTitle, "Inscription");
+    fr->set(SignInTitle, "Connexion");
+    auto frCA = std::make_shared<Catalog>("fr-CA", fr);
+    frCA->set(SignInTitle, "Ouvrir une session");
+    auto frQC = std::make_shared<Catalog>("fr-QC", frCA);
+    frQC->set(ButtonCancel, "Annuler");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    context.setSupportedCatalog<LocaleCatalog>(frCA);
+    context.setSupportedCatalog<LocaleCatalog>(frQC);
+    ASSERT_TRUE(context.setLocale("fr-QC"));
+
+    CatalogDelta delta("fr", 0, 1);
+    delta.set("signUpTitle", "Créer un compte");
+    ASSERT_TRUE(context.applyDelta<LocaleCatalog>(delta));
+    EXPECT_EQ(context.getCatalog("fr-CA")->parent(), context.getCatalog("fr")) << "fr-CA must be rebased on the new fr.";
+    EXPECT_EQ(context.getCatalog("fr-QC")->parent(), context.getCatalog("fr-CA")) << "fr-QC must be rebased on the new fr-CA.";
+    EXPECT_EQ(context.getHandle("fr-CA")->getSignUpTitle(), "Créer un compte");
+    EXPECT_EQ(context.getHandle("fr-CA")->getSignInTitle(), "Ouvrir une session");
+    EXPECT_EQ(context.getLocale(), context.getHandle("fr-QC").get()) << "The selection must follow fr-QC.";
+    EXPECT_EQ(context.getLocale()->getSignUpTitle(), "Créer un compte");
+    EXPECT_EQ(context.getLocale()->getButtonCancel(), "Annuler");
+}
+
+// Test 26: parallelFor() called from a task of its own pool does not wait for its queued helpers
+TEST(I18nTest, NestedParallelFor_26) {
+    ThreadPool pool(1);
+    auto total = pool.submit([&pool] {
+        std::atomic<std::size_t> sum = 0;
+        pool.parallelFor(1000, 10, [&sum](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+                sum += i;
+        });
+        return sum.load();
+    });
+    EXPECT_EQ(total.get(), 999u * 1000u / 2u);
+}
+
+// Test 27: A locale registered without a catalog replaces the catalog and the variants of its code
+TEST(I18nTest, CatalogReplacedByLocale_27) {
+    auto fr = std::make_shared<Catalog>("fr", defaultCatalogKeys());
+    fr->set(SignInTitle, "Connexion");
+    auto shortCopy = std::make_shared<Catalog>("fr", fr);
+    shortCopy->set(SignInTitle, "Se connecter");
+    auto en = std::make_shared<Catalog>("en", defaultCatalogKeys());
+    en->set(SignInTitle, "Sign in");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(en);
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    ASSERT_TRUE(context.setSupportedVariant<LocaleCatalog>(1, shortCopy));
+    ASSERT_TRUE(context.setLocale("fr", 1));
+
+    context.setSupportedLocale(std::make_shared<LocaleFr>());
+    EXPECT_EQ(context.getCatalog("fr"), nullptr) << "The replaced catalog is forgotten.";
+    EXPECT_EQ(context.getLocale(), context.getHandle("fr").get()) << "The selection falls back to the new locale.";
+    EXPECT_EQ(context.getLocale()->getSignInTitle(), "Connexion");
+    EXPECT_EQ(context.getHandle("fr", 1), context.getHandle("fr")) << "The variants of the catalog are dropped.";
+    EXPECT_TRUE(context.validateCatalogs("en").empty());
+
+    CatalogDelta delta("fr", 0, 1);
+    delta.set("signInTitle", "Ouvrir une session");
+    EXPECT_FALSE(context.applyDelta<LocaleCatalog>(delta)) << "A delta must not replace a locale without catalog.";
+    EXPECT_EQ(context.getHandle("fr")->getSignInTitle(), "Connexion");
+}
+
+// Test 28: Layers and variants keep the locale type they were registered with when rebased
+class BracketedCatalog : public LocaleCatalog {
+    public:
+        explicit BracketedCatalog(std::shared_ptr<const Catalog> catalog) : LocaleCatalog(std::move(catalog)) {}
+
+        const std::string getSignInTitle() const override { return "[" + LocaleCatalog::getSignInTitle() + "]"; }
+};
+
+TEST(I18nTest, RebasedLocaleType_28) {
+    auto fr = std::make_shared<Catalog>("fr", defaultCatalogKeys());
+    fr->set(SignInTitle, "Connexion");
+    auto frCA = std::make_shared<Catalog>("fr-CA", fr);
+    frCA->set(SignUpTitle, "S'inscrire");
+    auto shortCopy = std::make_shared<Catalog>("fr", fr);
+    shortCopy->set(SignUpTitle, "Créer un compte");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    context.setSupportedCatalog<BracketedCatalog>(frCA);
+    ASSERT_TRUE(context.setSupportedVariant<BracketedCatalog>(1, shortCopy));
+
+    CatalogDelta delta("fr", 0, 1);
+    delta.set("signInTitle", "Se connecter");
+    ASSERT_TRUE(context.applyDelta<LocaleCatalog>(delta));
+    EXPECT_EQ(context.getHandle("fr")->getSignInTitle(), "Se connecter");
+    EXPECT_EQ(context.getHandle("fr-CA")->getSignInTitle(), "[Se connecter]") << "The layer keeps its locale type.";
+    EXPECT_EQ(context.getHandle("fr", 1)->getSignInTitle(), "[Se connecter]") << "The variant keeps its locale type.";
+}
+
+namespace {
+
+struct ManualHop {
+    std::coroutine_handle<>& waiting;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> coroutine) const { waiting = coroutine; }
+    void await_resume() const noexcept {}
+};
+
+LocaleTask<DefaultLocale> readAfterResume(LocaleHandle<DefaultLocale>, std::coroutine_handle<>& waiting, std::string& seen) {
+    co_await ManualHop{waiting};
+    seen = LocaleHandle<DefaultLocale>::current()->getSignInTitle();
+}
+
+} // namespace
+
+// Test 29: Handles, scopes and suspended tasks keep their locale when the context reloads it
+TEST(I18nTest, HandleOutlivesReload_29) {
+    auto fr = std::make_shared<Catalog>("fr", defaultCatalogKeys());
+    fr->set(SignInTitle, "Connexion");
+    auto shortCopy = std::make_shared<Catalog>("fr", fr);
+    shortCopy->set(SignUpTitle, "Créer un compte");
+
+    I18nContext<DefaultLocale> context;
+    context.setSupportedCatalog<LocaleCatalog>(fr);
+    ASSERT_TRUE(context.setSupportedVariant<LocaleCatalog>(1, shortCopy));
+    ASSERT_TRUE(context.setLocale("fr"));
+    auto selected = context.getHandle();
+    auto variant = context.getHandle("fr", 1);
+    std::coroutine_handle<> waiting;
+    std::string seen;
+    auto task = readAfterResume(context.getHandle("fr"), waiting, seen);
+    {
+        LocaleScope<DefaultLocale> scope(context.getHandle("fr"));
+
+        CatalogDelta delta("fr", 0, 1);
+        delta.set("signInTitle", "Se connecter");
+        ASSERT_TRUE(context.applyDelta<LocaleCatalog>(delta));
+        EXPECT_EQ(context.getHandle("fr")->getSignInTitle(), "Se connecter");
+        EXPECT_EQ(LocaleHandle<DefaultLocale>::current()->getSignInTitle(), "Connexion") << "The scope keeps its locale.";
+    }
+    EXPECT_NE(selected, context.getHandle());
+    EXPECT_EQ(selected->getSignInTitle(), "Connexion") << "A handle outlives the reload of its locale.";
+    EXPECT_EQ(variant->getSignUpTitle(), "Créer un compte");
+
+    context.setSupportedLocale(std::make_shared<LocaleFr>());
+    EXPECT_EQ(context.getHandle("fr", 1), context.getHandle("fr")) << "The variants of the replaced catalog are dropped.";
+    EXPECT_EQ(variant->getSignInTitle(), "Connexion") << "A dropped variant stays readable through its handles.";
+
+    waiting.resume();
+    task.get();
+    EXPECT_EQ(seen, "Connexion") << "A suspended task resumes with the locale it was bound to.";
+}
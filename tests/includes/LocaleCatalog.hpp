@@ -0,0 +1,52 @@
+/**
+ * @file LocaleCatalog.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief 
+ * @date 2026-10-18
+ * 
+ * @example LocaleCatalog.hpp
+ * @{
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "DefaultLocale.hpp"
+#include "CatalogLocale.hpp"
+
+/**
+ * @brief Key indexes of DefaultLocale in a Catalog.
+ */
+enum DefaultKey {
+    SignUpTitle,
+    SignInTitle,
+    LoginSubTitle,
+    ButtonSubmit,
+    ButtonCancel
+};
+
+/**
+ * @brief Key list shared by every DefaultLocale catalog.
+ */
+inline std::shared_ptr<const CatalogKeys> defaultCatalogKeys() {
+    static const std::shared_ptr<const CatalogKeys> keys(new CatalogKeys({
+        "signUpTitle", "signInTitle", "loginSubTitle", "buttonSubmit", "buttonCancel"
+    }));
+
+    return keys;
+}
+
+/**
+ * @ingroup Example
+ */
+class LocaleCatalog: public CatalogLocale<DefaultLocale> {
+    public:
+        explicit LocaleCatalog(std::shared_ptr<const Catalog> catalog) : CatalogLocale<DefaultLocale>(catalog) {}
+
+        const std::string getSignUpTitle() const override { return text(SignUpTitle); }
+        const std::string getSignInTitle() const override { return text(SignInTitle); }
+        const std::string getButtonSubmit() const override { return text(ButtonSubmit); }
+        const std::string getLoginSubTitle() const override { return text(LoginSubTitle); }
+        const std::string getButtonCancel() const override { return text(ButtonCancel); }
+};
@@ -0,0 +1,31 @@
+/**
+ * @file LocaleCompressed.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ *
+ * @example LocaleCompressed.hpp
+ * @{
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "DefaultLocale.hpp"
+#include "LocaleCatalog.hpp"
+#include "CompressedLocale.hpp"
+
+/**
+ * @ingroup Example
+ */
+class LocaleCompressed: public CompressedLocale<DefaultLocale> {
+    public:
+        explicit LocaleCompressed(std::shared_ptr<const CompressedCatalog> catalog) : CompressedLocale<DefaultLocale>(catalog) {}
+
+        const std::string getSignUpTitle() const override { return text(SignUpTitle); }
+        const std::string getSignInTitle() const override { return text(SignInTitle); }
+        const std::string getButtonSubmit() const override { return text(ButtonSubmit); }
+        const std::string getLoginSubTitle() const override { return text(LoginSubTitle); }
+        const std::string getButtonCancel() const override { return text(ButtonCancel); }
+};
@@ -0,0 +1,28 @@
+/**
+ * @file LocaleDE.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief 
+ * @date 2026-10-18
+ * 
+ * @example LocaleDE.hpp
+ * @{
+ */
+
+#pragma once
+
+#include "DefaultLocale.hpp"
+
+/**
+ * @ingroup Example
+ */
+class LocaleDe: public DefaultLocale {
+    public:
+        static constexpr const char* code = "de";
+
+        const std::string languageCode() const override { return code; }
+        const std::string getSignUpTitle() const override { return "Registrieren"; }
+        const std::string getSignInTitle() const override { return "Anmelden"; }
+        const std::string getButtonSubmit() const override { return "Absenden"; }
+        const std::string getLoginSubTitle() const override { return "Willkommen!"; }
+        const std::string getButtonCancel() const override { return "Abbrechen"; }
+};
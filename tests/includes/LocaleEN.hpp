@@ -17,7 +17,9 @@
  */
 class LocaleEn: public DefaultLocale {
     public:
-        const std::string languageCode() const override { return "en"; }
+        static constexpr const char* code = "en";
+
+        const std::string languageCode() const override { return code; }
         const std::string getSignUpTitle() const override { return "Sign Up";}
         const std::string getSignInTitle() const override { return "Sign In";}
         const std::string getButtonSubmit() const override { return "Submit";}
@@ -17,7 +17,9 @@
  */
 class LocaleEs: public DefaultLocale {
     public:
-        const std::string languageCode() const override { return "es"; }
+        static constexpr const char* code = "es";
+
+        const std::string languageCode() const override { return code; }
         const std::string getSignUpTitle() const override { return "Registro"; }
         const std::string getSignInTitle() const override { return "Iniciar sesión"; }
         const std::string getButtonSubmit() const override { return "Enviar"; }
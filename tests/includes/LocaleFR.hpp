@@ -17,7 +17,9 @@
  */
 class LocaleFr: public DefaultLocale {
     public:
-        const std::string languageCode() const override { return "fr"; }
+        static constexpr const char* code = "fr";
+
+        const std::string languageCode() const override { return code; }
 
         const std::string getButtonCancel() const override { return "Annuler";}
         const std::string getButtonSubmit() const override { return "Valider";}
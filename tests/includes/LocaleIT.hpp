@@ -17,7 +17,9 @@
  */
 class LocaleIt: public DefaultLocale {
     public:
-        const std::string languageCode() const override { return "it"; }
+        static constexpr const char* code = "it";
+
+        const std::string languageCode() const override { return code; }
         const std::string getSignUpTitle() const override { return "Registrati"; }
         const std::string getSignInTitle() const override { return "Accedi"; }
         const std::string getButtonSubmit() const override { return "Invia"; }
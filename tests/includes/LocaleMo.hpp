@@ -0,0 +1,97 @@
+/**
+ * @file LocaleMo.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief
+ * @date 2026-10-18
+ *
+ * @example LocaleMo.hpp
+ * @{
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DefaultLocale.hpp"
+#include "MoLocale.hpp"
+
+/**
+ * @ingroup Example
+ */
+class LocaleMo: public MoLocale<DefaultLocale> {
+    public:
+        explicit LocaleMo(std::shared_ptr<const MoFile> file) : MoLocale<DefaultLocale>(file) {}
+
+        const std::string getSignUpTitle() const override { return text("Sign up"); }
+        const std::string getSignInTitle() const override { return text("Sign in"); }
+        const std::string getButtonSubmit() const override { return text("Submit"); }
+        const std::string getLoginSubTitle() const override { return text("Sign in to continue"); }
+        const std::string getButtonCancel() const override { return text("Cancel"); }
+};
+
+/**
+ * @brief Write a `.mo` file as msgfmt does: sorted msgids, then the hashpjw table.
+ *
+ * @param path Destination.
+ * @param entries Pairs of msgid ("singular\0plural" for plurals) and translation ("form0\0form1...").
+ * @param bigEndian Byte order of the file.
+ * @param hashTable false to leave the hash table out (size 0).
+ */
+inline bool writeMoFile(const std::string& path, std::vector<std::pair<std::string, std::string>> entries, bool bigEndian, bool hashTable = true) {
+    std::sort(entries.begin(), entries.end());
+    std::uint32_t count = static_cast<std::uint32_t>(entries.size());
+    std::uint32_t hashSize = 0;
+    if (hashTable) {
+        hashSize = count * 4 / 3 < 3 ? 3 : count * 4 / 3;
+        for (bool prime = false; !prime; ) {
+            prime = true;
+            for (std::uint32_t d = 2; d * d <= hashSize; ++d)
+                if (hashSize % d == 0)
+                    prime = false;
+            hashSize += prime ? 0 : 1;
+        }
+    }
+
+    std::vector<std::uint32_t> hashes(hashSize, 0);
+    for (std::uint32_t i = 0; i < count && hashSize > 0; ++i) {
+        const std::string& msgid = entries[i].first;
+        std::uint32_t value = MoFile::hash(msgid.c_str(), msgid.find('\0') == std::string::npos ? msgid.size() : msgid.find('\0'));
+        std::uint32_t index = value % hashSize;
+        std::uint32_t increment = 1 + value % (hashSize - 2);
+        while (hashes[index] != 0)
+            index = index >= hashSize - increment ? index - (hashSize - increment) : index + increment;
+        hashes[index] = i + 1;
+    }
+
+    std::uint32_t originals = 28;
+    std::uint32_t translations = originals + count * 8;
+    std::uint32_t hashOffset = translations + count * 8;
+    std::uint32_t offset = hashOffset + hashSize * 4;
+    std::vector<std::uint32_t> words = {0x950412DEu, 0, count, originals, translations, hashSize, hashOffset};
+    std::string strings;
+    for (int table = 0; table < 2; ++table) {
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const std::string& text = table == 0 ? entries[i].first : entries[i].second;
+            words.push_back(static_cast<std::uint32_t>(text.size()));
+            words.push_back(offset + static_cast<std::uint32_t>(strings.size()));
+            strings.append(text);
+            strings += '\0';
+        }
+    }
+    words.insert(words.end(), hashes.begin(), hashes.end());
+
+    std::ofstream out(path.c_str(), std::ios::binary);
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        for (int byte = 0; byte < 4; ++byte) {
+            int shift = bigEndian ? 24 - byte * 8 : byte * 8;
+            out.put(static_cast<char>((words[i] >> shift) & 0xFF));
+        }
+    }
+    out.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+    return static_cast<bool>(out);
+}
@@ -0,0 +1,28 @@
+/**
+ * @file LocalePT.hpp
+ * @author Perry Chouteau (perry.chouteau@outlook.com)
+ * @brief 
+ * @date 2026-10-18
+ * 
+ * @example LocalePT.hpp
+ * @{
+ */
+
+#pragma once
+
+#include "DefaultLocale.hpp"
+
+/**
+ * @ingroup Example
+ */
+class LocalePt: public DefaultLocale {
+    public:
+        static constexpr const char* code = "pt";
+
+        const std::string languageCode() const override { return code; }
+        const std::string getSignUpTitle() const override { return "Cadastrar"; }
+        const std::string getSignInTitle() const override { return "Entrar"; }
+        const std::string getButtonSubmit() const override { return "Enviar"; }
+        const std::string getLoginSubTitle() const override { return "Bem-vindo!"; }
+        const std::string getButtonCancel() const override { return "Cancelar"; }
+};